@@ -1,9 +1,12 @@
+#ifndef NSTD_ALGORITHM_HPP
+#define NSTD_ALGORITHM_HPP
+
 #include <algorithm>
 #include <functional>
 #include <iterator>
 
 namespace nstd {
-template<typename Iterator, Comparator>
+template<typename Iterator, typename Comparator>
 Iterator lomuto_partition(Iterator begin, Iterator end, Comparator comp) {
     auto last = std::prev(end);
     auto pivot = last;
@@ -50,30 +53,6 @@ Iterator hoare_partition(Iterator begin, Iterator end, Comparator comp) {
     }
 }
 
-template<typename Iterator, typename Comparator>
-Iterator hoare_partition(Iterator begin, Iterator end, Comparator comp) {
-    auto i = begin;
-    auto j = std::prev(end);
-
-    auto pivot = *j;
-
-    while (i <= j) {
-        while (*i < pivot) {
-            ++i;
-        }
-
-        while (*j > pivot) {
-            ++j;
-        }
-
-        if (i < j) {
-            std::iter_swap(i, j);
-        }
-    }
-
-    return j;
-}
-
 template<typename Iterator, typename Comparator>
 void quick_sort(Iterator begin, Iterator end, Comparator comp) {
     if (begin == end || std::next(begin) == end) {
@@ -94,4 +73,6 @@ template<typename Iterator, typename Comparator>
 void sort(Iterator begin, Iterator end, Comparator comp) {
     nstd::quick_sort(begin, end, comp);
 }
-} // namespace nstd
\ No newline at end of file
+} // namespace nstd
+
+#endif // NSTD_ALGORITHM_HPP
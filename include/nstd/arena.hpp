@@ -0,0 +1,199 @@
+#ifndef NSTD_ARENA_HPP
+#define NSTD_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace nstd {
+
+// Monotonic (bump pointer) allocator.
+//
+// Allocation moves a pointer forward inside the current chunk; deallocate() is a no-op. Memory is
+// only reclaimed as a whole: reset() rewinds to the start in O(1) and keeps every chunk for reuse,
+// release() hands the chunks back to the system.
+//
+// Chunks grow geometrically. An optional caller-provided buffer (see inline_arena) is used first,
+// so short-lived arenas often never touch the heap at all.
+class arena {
+    struct chunk_header {
+        chunk_header* next;
+        size_t size;
+    };
+
+public:
+    explicit arena(size_t initial_chunk_size = 4096) noexcept
+        : _next_chunk_size{std::max(initial_chunk_size, sizeof(chunk_header) * 2)} {}
+
+    arena(void* buffer, size_t buffer_size, size_t initial_chunk_size = 4096) noexcept
+        : arena(initial_chunk_size) {
+        _buffer = static_cast<std::byte*>(buffer);
+        _buffer_size = buffer_size;
+        reset();
+    }
+
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    ~arena() {
+        release();
+    }
+
+    void* allocate(size_t bytes, size_t align = alignof(std::max_align_t)) {
+        auto* result{_bump(bytes, align)};
+
+        if (!result) {
+            _next_chunk(bytes, align);
+            result = _bump(bytes, align);
+        }
+
+        return result;
+    }
+
+    // Individual objects are never freed; memory comes back on reset() / release().
+    void deallocate(void*, size_t, size_t = alignof(std::max_align_t)) noexcept {}
+
+    // Forget every allocation but keep all chunks for reuse.
+    void reset() noexcept {
+        _current = nullptr;
+        _ptr = _buffer;
+        _end = _buffer + _buffer_size;
+    }
+
+    // Forget every allocation and free all heap chunks.
+    void release() noexcept {
+        while (_head) {
+            auto* next{_head->next};
+            ::operator delete(_head);
+            _head = next;
+        }
+        _tail = nullptr;
+        reset();
+    }
+
+    // Bytes still available in the current chunk.
+    size_t remaining() const noexcept {
+        return static_cast<size_t>(_end - _ptr);
+    }
+
+private:
+    void* _bump(size_t bytes, size_t align) noexcept {
+        auto address{reinterpret_cast<std::uintptr_t>(_ptr)};
+        auto aligned{(address + align - 1) & ~(static_cast<std::uintptr_t>(align) - 1)};
+
+        if (!_ptr || aligned - address > remaining() || bytes > remaining() - (aligned - address)) {
+            return nullptr;
+        }
+
+        _ptr += (aligned - address) + bytes;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void _next_chunk(size_t bytes, size_t align) {
+        // Worst case padding is align - 1 bytes after the header.
+        if (bytes > std::numeric_limits<size_t>::max() - align - sizeof(chunk_header)) {
+            throw std::bad_alloc{};
+        }
+        const size_t needed{bytes + align - 1};
+
+        // After a reset, walk the chunks we already own before asking the system for more.
+        for (auto* chunk{_current ? _current->next : _head}; chunk; chunk = chunk->next) {
+            if (chunk->size >= needed) {
+                _use(chunk);
+                return;
+            }
+        }
+
+        const size_t size{std::max(_next_chunk_size, needed)};
+        auto* chunk{static_cast<chunk_header*>(::operator new(sizeof(chunk_header) + size))};
+        chunk->next = nullptr;
+        chunk->size = size;
+
+        if (_tail) {
+            _tail->next = chunk;
+        } else {
+            _head = chunk;
+        }
+        _tail = chunk;
+
+        _next_chunk_size = size * 2;
+        _use(chunk);
+    }
+
+    void _use(chunk_header* chunk) noexcept {
+        _current = chunk;
+        _ptr = reinterpret_cast<std::byte*>(chunk + 1);
+        _end = _ptr + chunk->size;
+    }
+
+    std::byte* _ptr{};
+    std::byte* _end{};
+
+    chunk_header* _current{};
+    chunk_header* _head{};
+    chunk_header* _tail{};
+    size_t _next_chunk_size{};
+
+    std::byte* _buffer{};
+    size_t _buffer_size{};
+};
+
+// Arena with its first InlineSize bytes embedded in the object itself (typically on the stack).
+template<size_t InlineSize> class inline_arena : public arena {
+public:
+    explicit inline_arena(size_t initial_chunk_size = 4096) noexcept
+        : arena(_storage, InlineSize, initial_chunk_size) {}
+
+private:
+    alignas(std::max_align_t) std::byte _storage[InlineSize];
+};
+
+// Standard Allocator over an arena. The arena must outlive every allocator copy.
+template<typename T> class arena_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template<typename U> struct rebind {
+        using other = arena_allocator<U>;
+    };
+
+    explicit arena_allocator(arena& source) noexcept : _arena{&source} {}
+
+    template<typename U>
+    arena_allocator(const arena_allocator<U>& other) noexcept : _arena{other.source()} {}
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length{};
+        }
+        return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    arena* source() const noexcept {
+        return _arena;
+    }
+
+    template<typename U>
+    friend bool operator==(const arena_allocator& a, const arena_allocator<U>& b) {
+        return a.source() == b.source();
+    }
+
+private:
+    arena* _arena{};
+};
+
+} // namespace nstd
+
+#endif // NSTD_ARENA_HPP
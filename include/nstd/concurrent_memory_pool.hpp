@@ -0,0 +1,270 @@
+#ifndef NSTD_CONCURRENT_MEMORY_POOL
+#define NSTD_CONCURRENT_MEMORY_POOL
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+
+#include "nstd/shared_ptr.hpp"
+#include "nstd/vector.hpp"
+
+namespace nstd {
+
+// Thread-safe counterpart of nstd::memory_pool.
+//
+// Every thread owns a small private free list (its cache), so the common allocate/deallocate
+// path touches no lock and no shared cache line. Caches talk to a shared depot only in batches:
+// an empty cache grabs a whole batch, a cache holding 2 * BatchSize blocks hands one batch back.
+//
+// All chunks belong to the depot, so a block may be freed on any thread, not just the one that
+// allocated it: it simply lands in the freeing thread's cache and migrates back through the depot
+// (this is exactly the producer/consumer case).
+//
+// The depot is shared-owned by the pool and by every thread cache that has touched it, so a
+// thread exiting after the pool is gone (or the other way around) never touches freed memory.
+//
+// Once a thread's caches have been torn down (it is exiting, or for the main thread, static
+// destructors are running) its allocations and frees go straight to the depot under its lock, so
+// pools and containers with static storage duration keep working during program exit.
+template<typename T, size_t BlocksPerChunk = 100, size_t BatchSize = 32>
+class concurrent_memory_pool {
+    static_assert(BatchSize > 0, "BatchSize must be greater than 0");
+
+    struct batch {
+        void* head{};
+        size_t count{};
+    };
+
+    struct depot {
+        std::mutex mtx{};
+        nstd::vector<batch> batches{};
+        nstd::vector<void*> chunks{};
+        std::atomic<bool> closed{};
+
+        ~depot() {
+            for (auto* chunk : chunks) {
+                ::operator delete(chunk, std::align_val_t{block_align});
+            }
+        }
+    };
+
+    struct thread_cache {
+        depot* owner{};
+        nstd::shared_ptr<depot> keep_alive{};
+        void* head{};
+        size_t count{};
+    };
+
+    // One registry per thread, holding that thread's cache for every pool it has used.
+    struct registry {
+        nstd::vector<thread_cache> caches{};
+
+        ~registry() {
+            _torn_down = true;
+            _last_owner = nullptr;
+            _last_cache = nullptr;
+            for (auto& cache : caches) {
+                if (!cache.owner->closed.load(std::memory_order_acquire)) {
+                    _flush(cache.owner, cache.head, cache.count);
+                }
+            }
+        }
+    };
+
+public:
+    concurrent_memory_pool() : _depot{nstd::make_shared<depot>()} {
+        _raw_depot = &*_depot;
+    }
+
+    template<typename... Args> T* allocate(Args&&... args) {
+        void* result{_acquire()};
+
+        try {
+            return new (result) T(std::forward<Args>(args)...);
+        } catch (...) {
+            _give_back(result);
+            throw;
+        }
+    }
+
+    void deallocate(T* ptr) {
+        if (!ptr) {
+            return;
+        }
+
+        ptr->~T();
+        _give_back(ptr);
+    }
+
+    // Other threads drop their caches of this pool lazily. The destroying thread's cache stays in
+    // its registry too: the registry is thread_local and may already be gone when a pool with
+    // static storage duration is destroyed, and the stale entry is pruned on the next
+    // registration or at thread exit.
+    ~concurrent_memory_pool() {
+        _raw_depot->closed.store(true, std::memory_order_release);
+        if (_last_owner == _raw_depot) {
+            _last_owner = nullptr;
+            _last_cache = nullptr;
+        }
+    }
+
+    concurrent_memory_pool(const concurrent_memory_pool&) = delete;
+    concurrent_memory_pool& operator=(const concurrent_memory_pool&) = delete;
+
+private:
+    void* _acquire() {
+        if (_torn_down) {
+            return _take_one();
+        }
+
+        auto& cache{_local_cache()};
+
+        if (!cache.head) {
+            auto refill{_refill()};
+            cache.head = refill.head;
+            cache.count = refill.count;
+        }
+
+        void* result{cache.head};
+        cache.head = *reinterpret_cast<void**>(result);
+        --cache.count;
+        return result;
+    }
+
+    void _give_back(void* block) {
+        if (_torn_down) {
+            *reinterpret_cast<void**>(block) = nullptr;
+            _flush(_raw_depot, block, 1);
+            return;
+        }
+
+        auto& cache{_local_cache()};
+        *reinterpret_cast<void**>(block) = cache.head;
+        cache.head = block;
+        ++cache.count;
+
+        if (cache.count >= 2 * BatchSize) {
+            // Detach the first BatchSize blocks and give them back to the depot.
+            void* tail{cache.head};
+            for (size_t i{1}; i < BatchSize; ++i) {
+                tail = *reinterpret_cast<void**>(tail);
+            }
+
+            void* batch_head{cache.head};
+            cache.head = *reinterpret_cast<void**>(tail);
+            cache.count -= BatchSize;
+            *reinterpret_cast<void**>(tail) = nullptr;
+
+            _flush(_raw_depot, batch_head, BatchSize);
+        }
+    }
+
+    thread_cache& _local_cache() {
+        // Fast path: plain thread_local pointers need no lazy-init guard, unlike the registry.
+        if (_last_owner == _raw_depot) {
+            return *_last_cache;
+        }
+
+        auto& caches{_registry.caches};
+
+        for (size_t i{}; i < caches.size(); ++i) {
+            if (caches[i].owner == _raw_depot) {
+                return _remember(i);
+            }
+        }
+
+        // First use on this thread: prune caches of pools destroyed since, then register.
+        for (size_t i{caches.size()}; i > 0; --i) {
+            if (caches[i - 1].owner->closed.load(std::memory_order_acquire)) {
+                caches.erase(caches.begin() + (i - 1));
+            }
+        }
+
+        caches.push_back(thread_cache{_raw_depot, _depot, nullptr, 0});
+        return _remember(caches.size() - 1);
+    }
+
+    // Any change to the registry may move its caches, so the fast path is refreshed every time.
+    thread_cache& _remember(size_t index) {
+        _last_owner = _raw_depot;
+        _last_cache = &_registry.caches[index];
+        return *_last_cache;
+    }
+
+    batch _refill() {
+        std::lock_guard lock{_raw_depot->mtx};
+
+        if (_raw_depot->batches.is_empty()) {
+            _expand();
+        }
+
+        auto result{_raw_depot->batches.back()};
+        _raw_depot->batches.pop_back();
+        return result;
+    }
+
+    // Uncached allocation for threads whose caches are gone.
+    void* _take_one() {
+        std::lock_guard lock{_raw_depot->mtx};
+
+        if (_raw_depot->batches.is_empty()) {
+            _expand();
+        }
+
+        auto& source{_raw_depot->batches.back()};
+        void* result{source.head};
+        source.head = *reinterpret_cast<void**>(result);
+        if (--source.count == 0) {
+            _raw_depot->batches.pop_back();
+        }
+        return result;
+    }
+
+    static void _flush(depot* target, void* head, size_t count) {
+        if (!head) {
+            return;
+        }
+
+        std::lock_guard lock{target->mtx};
+        target->batches.push_back(batch{head, count});
+    }
+
+    // Called with the depot lock held. Carves a new chunk into ready-made batches.
+    void _expand() {
+        auto* const raw_mem{
+            ::operator new(block_size * chunk_blocks, std::align_val_t{block_align})};
+        _raw_depot->chunks.push_back(raw_mem);
+
+        char* ptr = static_cast<char*>(raw_mem);
+
+        for (size_t first{}; first < chunk_blocks; first += BatchSize) {
+            for (size_t i{first}; i < first + BatchSize - 1; ++i) {
+                *reinterpret_cast<void**>(ptr + (i * block_size)) = ptr + ((i + 1) * block_size);
+            }
+            *reinterpret_cast<void**>(ptr + ((first + BatchSize - 1) * block_size)) = nullptr;
+
+            _raw_depot->batches.push_back(batch{ptr + (first * block_size), BatchSize});
+        }
+    }
+
+    nstd::shared_ptr<depot> _depot{};
+    depot* _raw_depot{};
+
+    static inline thread_local registry _registry{};
+    static inline thread_local depot* _last_owner{};
+    static inline thread_local thread_cache* _last_cache{};
+    // Set by the registry destructor. Trivially destructible, so still readable afterwards.
+    static inline thread_local bool _torn_down{};
+
+    static constexpr size_t block_align{std::max(alignof(T), alignof(void*))};
+    static constexpr size_t block_size{
+        ((std::max(sizeof(T), sizeof(void*)) + block_align - 1) / block_align) * block_align};
+
+    // Chunks are always a whole number of batches.
+    static constexpr size_t chunk_blocks{
+        ((std::max(BlocksPerChunk, BatchSize) + BatchSize - 1) / BatchSize) * BatchSize};
+};
+} // namespace nstd
+
+#endif
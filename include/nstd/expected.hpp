@@ -3,6 +3,8 @@
 
 #include <cassert>
 #include <compare>
+#include <exception>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
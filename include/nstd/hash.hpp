@@ -0,0 +1,144 @@
+#ifndef NSTD_HASH_HPP
+#define NSTD_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+
+namespace nstd {
+
+namespace detail {
+
+#if defined(__SIZEOF_INT128__)
+// __extension__ keeps -Wpedantic quiet about the non-standard type.
+__extension__ using uint128 = unsigned __int128;
+#endif
+
+// 64x64 -> 128 bit multiply, returned as (low, high) through the arguments.
+inline void multiply_128(std::uint64_t& low, std::uint64_t& high) noexcept {
+#if defined(__SIZEOF_INT128__)
+    const auto product{static_cast<uint128>(low) * high};
+    low = static_cast<std::uint64_t>(product);
+    high = static_cast<std::uint64_t>(product >> 64);
+#else
+    const std::uint64_t a_lo{low & 0xFFFFFFFFu}, a_hi{low >> 32};
+    const std::uint64_t b_lo{high & 0xFFFFFFFFu}, b_hi{high >> 32};
+    const std::uint64_t lo_lo{a_lo * b_lo}, hi_lo{a_hi * b_lo};
+    const std::uint64_t lo_hi{a_lo * b_hi}, hi_hi{a_hi * b_hi};
+    const std::uint64_t cross{(lo_lo >> 32) + (hi_lo & 0xFFFFFFFFu) + lo_hi};
+    low = (cross << 32) | (lo_lo & 0xFFFFFFFFu);
+    high = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+#endif
+}
+
+inline std::uint64_t mix(std::uint64_t first, std::uint64_t second) noexcept {
+    multiply_128(first, second);
+    return first ^ second;
+}
+
+inline std::uint64_t read_64(const unsigned char* ptr) noexcept {
+    std::uint64_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+inline std::uint64_t read_32(const unsigned char* ptr) noexcept {
+    std::uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+// Up to three bytes, without reading past the end.
+inline std::uint64_t read_small(const unsigned char* ptr, size_t count) noexcept {
+    return (std::uint64_t{ptr[0]} << 16) | (std::uint64_t{ptr[count >> 1]} << 8) | ptr[count - 1];
+}
+
+inline constexpr std::uint64_t hash_secret[4]{0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+                                              0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+} // namespace detail
+
+// Fast non-cryptographic 64-bit hash of a byte range (the wyhash construction).
+//
+// Inputs up to 16 bytes are read with at most four overlapping loads and no loop. Longer inputs
+// are consumed 48 bytes per iteration on three independent multiply lanes, which keeps the
+// multipliers busy in parallel, and merged at the end. Results depend on the byte order of the
+// host and are not meant to be persisted.
+inline std::uint64_t hash_bytes(const void* data, size_t size, std::uint64_t seed = 0) noexcept {
+    using detail::hash_secret;
+    using detail::mix;
+    using detail::read_32;
+    using detail::read_64;
+
+    const auto* ptr{static_cast<const unsigned char*>(data)};
+    seed ^= mix(seed ^ hash_secret[0], hash_secret[1]);
+
+    std::uint64_t a{};
+    std::uint64_t b{};
+    if (size <= 16) {
+        if (size >= 4) {
+            const auto offset{(size >> 3) << 2};
+            a = (read_32(ptr) << 32) | read_32(ptr + offset);
+            b = (read_32(ptr + size - 4) << 32) | read_32(ptr + size - 4 - offset);
+        } else if (size > 0) {
+            a = detail::read_small(ptr, size);
+        }
+    } else {
+        auto remaining{size};
+        if (remaining > 48) {
+            auto lane_1{seed};
+            auto lane_2{seed};
+            do {
+                seed = mix(read_64(ptr) ^ hash_secret[1], read_64(ptr + 8) ^ seed);
+                lane_1 = mix(read_64(ptr + 16) ^ hash_secret[2], read_64(ptr + 24) ^ lane_1);
+                lane_2 = mix(read_64(ptr + 32) ^ hash_secret[3], read_64(ptr + 40) ^ lane_2);
+                ptr += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane_1 ^ lane_2;
+        }
+        while (remaining > 16) {
+            seed = mix(read_64(ptr) ^ hash_secret[1], read_64(ptr + 8) ^ seed);
+            ptr += 16;
+            remaining -= 16;
+        }
+        // The last 16 bytes, overlapping what was already consumed.
+        a = read_64(ptr + remaining - 16);
+        b = read_64(ptr + remaining - 8);
+    }
+
+    a ^= hash_secret[1];
+    b ^= seed;
+    detail::multiply_128(a, b);
+    return mix(a ^ hash_secret[0] ^ size, b ^ hash_secret[1]);
+}
+
+// Hash function object. Strings and string views of the same characters hash equally, and the
+// string specializations are transparent, so unordered containers keyed by nstd::string can be
+// probed with a view without building a temporary string.
+template<typename T> struct hash : std::hash<T> {};
+
+template<typename CharT> struct hash<basic_string_view<CharT>> {
+    using is_transparent = void;
+
+    size_t operator()(basic_string_view<CharT> view) const noexcept {
+        return static_cast<size_t>(hash_bytes(view.data(), view.size() * sizeof(CharT)));
+    }
+};
+
+template<typename CharT, typename Allocator>
+struct hash<basic_string<CharT, Allocator>> : hash<basic_string_view<CharT>> {};
+
+} // namespace nstd
+
+template<typename CharT> struct std::hash<nstd::basic_string_view<CharT>>
+    : nstd::hash<nstd::basic_string_view<CharT>> {};
+
+template<typename CharT, typename Allocator> struct std::hash<nstd::basic_string<CharT, Allocator>>
+    : nstd::hash<nstd::basic_string<CharT, Allocator>> {};
+
+#endif // NSTD_HASH_HPP
@@ -0,0 +1,109 @@
+#ifndef NSTD_HASHED_STRING_HPP
+#define NSTD_HASHED_STRING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "nstd/hash.hpp"
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+
+namespace nstd {
+
+// Immutable string that carries its hash_bytes() value, computed once at construction.
+//
+// Hashing it as a container key returns the stored value, and equality compares the hashes
+// before looking at any characters, so unequal keys are usually rejected with one integer compare.
+template<typename CharT, typename Allocator = std::allocator<CharT>> class basic_hashed_string {
+public:
+    using string_type = basic_string<CharT, Allocator>;
+    using view_type = basic_string_view<CharT>;
+
+    basic_hashed_string() : _hash{_hash_of(view_type{})} {}
+
+    basic_hashed_string(view_type view, const Allocator& alloc = Allocator())
+        : _str{view, alloc}, _hash{_hash_of(view)} {}
+
+    basic_hashed_string(const CharT* str, const Allocator& alloc = Allocator())
+        : basic_hashed_string(view_type{str}, alloc) {}
+
+    explicit basic_hashed_string(string_type str)
+        : _str{std::move(str)}, _hash{_hash_of(_str)} {}
+
+    size_t hash() const noexcept {
+        return _hash;
+    }
+
+    const string_type& str() const noexcept {
+        return _str;
+    }
+
+    view_type view() const noexcept {
+        return _str;
+    }
+
+    operator view_type() const noexcept {
+        return _str;
+    }
+
+    const CharT* c_str() const noexcept {
+        return _str.c_str();
+    }
+
+    size_t size() const noexcept {
+        return _str.size();
+    }
+
+    bool empty() const noexcept {
+        return _str.empty();
+    }
+
+    friend bool operator==(const basic_hashed_string& first,
+                           const basic_hashed_string& second) noexcept {
+        return first._hash == second._hash && first.view() == second.view();
+    }
+
+    friend bool operator==(const basic_hashed_string& first, view_type second) noexcept {
+        return first.view() == second;
+    }
+
+    friend void swap(basic_hashed_string& first, basic_hashed_string& second) noexcept {
+        using std::swap;
+        swap(first._str, second._str);
+        swap(first._hash, second._hash);
+    }
+
+private:
+    static size_t _hash_of(view_type view) noexcept {
+        return nstd::hash<view_type>{}(view);
+    }
+
+    string_type _str;
+    size_t _hash;
+};
+
+using hashed_string = basic_hashed_string<char>;
+
+// Returns the stored hash. Plain views hash to the same value, so lookups may also be made by view.
+template<typename CharT, typename Allocator> struct hash<basic_hashed_string<CharT, Allocator>> {
+    using is_transparent = void;
+
+    size_t operator()(const basic_hashed_string<CharT, Allocator>& str) const noexcept {
+        return str.hash();
+    }
+
+    size_t operator()(basic_string_view<CharT> view) const noexcept {
+        return hash<basic_string_view<CharT>>{}(view);
+    }
+};
+
+} // namespace nstd
+
+template<typename CharT, typename Allocator>
+struct std::hash<nstd::basic_hashed_string<CharT, Allocator>>
+    : nstd::hash<nstd::basic_hashed_string<CharT, Allocator>> {};
+
+#endif // NSTD_HASHED_STRING_HPP
@@ -0,0 +1,402 @@
+#ifndef NSTD_INTRUSIVE_LIST_HPP
+#define NSTD_INTRUSIVE_LIST_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace nstd {
+
+// How a hook behaves when its object dies while still linked.
+//
+// safe:        the hook asserts it was unlinked first. The list keeps an O(1) size().
+// auto_unlink: the hook unlinks itself, and the object may also unlink itself at any time through
+//              hook.unlink(). The list can not see that happen, so its size() is O(n).
+enum class link_mode { safe, auto_unlink };
+
+// The two links shared by hooks and by the list's own sentinel. Linked hooks form a ring through
+// the sentinel, so unlinking never needs to know which list a hook is in.
+class list_hook_base {
+    template<typename T, auto Hook> friend class intrusive_list;
+    template<link_mode> friend class list_hook;
+
+    void _unlink() noexcept {
+        if (_next) {
+            _prev->_next = _next;
+            _next->_prev = _prev;
+            _prev = nullptr;
+            _next = nullptr;
+        }
+    }
+
+    // Inserts this (unlinked) node in front of `pos`.
+    void _link_before(list_hook_base* pos) noexcept {
+        _prev = pos->_prev;
+        _next = pos;
+        pos->_prev->_next = this;
+        pos->_prev = this;
+    }
+
+    list_hook_base* _prev{};
+    list_hook_base* _next{};
+};
+
+// Member hook embedded in the objects of an intrusive_list. Copying an object never copies its
+// list membership: a copied or assigned hook stays as it was.
+template<link_mode Mode = link_mode::safe> class list_hook : private list_hook_base {
+    template<typename T, auto Hook> friend class intrusive_list;
+
+public:
+    static constexpr link_mode mode{Mode};
+
+    list_hook() = default;
+    list_hook(const list_hook&) noexcept {}
+
+    list_hook& operator=(const list_hook&) noexcept {
+        return *this;
+    }
+
+    ~list_hook() {
+        if constexpr (Mode == link_mode::auto_unlink) {
+            _unlink();
+        } else {
+            assert(!is_linked() && "object destroyed while still in an intrusive_list");
+        }
+    }
+
+    bool is_linked() const noexcept {
+        return _next != nullptr;
+    }
+
+    // Removes the object from whatever list holds it, in O(1).
+    void unlink() noexcept
+        requires(Mode == link_mode::auto_unlink)
+    {
+        _unlink();
+    }
+};
+
+// Doubly linked list over objects that carry their own links (no allocation at all).
+//
+// Hook is a pointer to the list_hook member, e.g. nstd::intrusive_list<Timer, &Timer::hook>. An
+// object can sit in several lists at once through several hooks. The list never owns its objects:
+// clear() and the destructor only unlink them.
+template<typename T, auto Hook> class intrusive_list {
+    template<typename> struct member_traits;
+    template<typename C, typename M> struct member_traits<M C::*> {
+        using class_type = C;
+        using member_type = M;
+    };
+
+    using hook_type = typename member_traits<decltype(Hook)>::member_type;
+    static_assert(std::is_base_of_v<typename member_traits<decltype(Hook)>::class_type, T>,
+                  "Hook must be a member of T");
+
+    static constexpr bool constant_time_size{hook_type::mode == link_mode::safe};
+
+    template<bool Const> class basic_iterator;
+
+public:
+    using value_type = T;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    intrusive_list() noexcept {
+        _sentinel._prev = &_sentinel;
+        _sentinel._next = &_sentinel;
+    }
+
+    intrusive_list(const intrusive_list&) = delete;
+    intrusive_list& operator=(const intrusive_list&) = delete;
+
+    intrusive_list(intrusive_list&& other) noexcept : intrusive_list() {
+        swap(*this, other);
+    }
+
+    intrusive_list& operator=(intrusive_list&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(*this, other);
+        }
+        return *this;
+    }
+
+    ~intrusive_list() {
+        clear();
+    }
+
+    void push_front(T& value) noexcept {
+        insert(begin(), value);
+    }
+
+    void push_back(T& value) noexcept {
+        insert(end(), value);
+    }
+
+    void pop_front() noexcept {
+        if (!empty()) {
+            erase(begin());
+        }
+    }
+
+    void pop_back() noexcept {
+        if (!empty()) {
+            erase(--end());
+        }
+    }
+
+    T& front() noexcept {
+        assert(!empty());
+        return *begin();
+    }
+
+    const T& front() const noexcept {
+        assert(!empty());
+        return *begin();
+    }
+
+    T& back() noexcept {
+        assert(!empty());
+        return *--end();
+    }
+
+    const T& back() const noexcept {
+        assert(!empty());
+        return *--end();
+    }
+
+    bool empty() const noexcept {
+        return _sentinel._next == &_sentinel;
+    }
+
+    // O(1) with safe hooks, O(n) with auto_unlink hooks.
+    size_t size() const noexcept {
+        if constexpr (constant_time_size) {
+            return _size;
+        } else {
+            size_t count{};
+            for (auto* node{_sentinel._next}; node != &_sentinel; node = node->_next) {
+                ++count;
+            }
+            return count;
+        }
+    }
+
+    // Unlinks every object. The objects themselves are untouched.
+    void clear() noexcept {
+        auto* node{_sentinel._next};
+        while (node != &_sentinel) {
+            auto* next{node->_next};
+            node->_prev = nullptr;
+            node->_next = nullptr;
+            node = next;
+        }
+
+        _sentinel._prev = &_sentinel;
+        _sentinel._next = &_sentinel;
+        _size = 0;
+    }
+
+    iterator insert(const_iterator pos, T& value) noexcept {
+        auto* node{_hook(value)};
+        assert(!node->_next && "object is already linked into a list");
+
+        node->_link_before(pos._node);
+        ++_size;
+        return iterator(node);
+    }
+
+    iterator erase(const_iterator pos) noexcept {
+        assert(pos._node != &_sentinel);
+
+        auto* next{pos._node->_next};
+        pos._node->_unlink();
+        --_size;
+        return iterator(next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        while (first != last) {
+            first = erase(first);
+        }
+        return iterator(last._node);
+    }
+
+    // Moves every object of `other` in front of `pos`, in O(1).
+    void splice(const_iterator pos, intrusive_list& other) noexcept {
+        if (this == &other || other.empty()) {
+            return;
+        }
+
+        auto* first{other._sentinel._next};
+        auto* last{other._sentinel._prev};
+
+        other._sentinel._prev = &other._sentinel;
+        other._sentinel._next = &other._sentinel;
+
+        first->_prev = pos._node->_prev;
+        last->_next = pos._node;
+        pos._node->_prev->_next = first;
+        pos._node->_prev = last;
+
+        _size += other._size;
+        other._size = 0;
+    }
+
+    // Moves the single object at `it` from `other` in front of `pos`, in O(1).
+    void splice(const_iterator pos, intrusive_list& other, const_iterator it) noexcept {
+        auto* node{it._node};
+        if (node == pos._node || node->_next == pos._node) {
+            return;
+        }
+
+        node->_unlink();
+        node->_link_before(pos._node);
+        --other._size;
+        ++_size;
+    }
+
+    // Iterator to an object known to be in this list, in O(1).
+    iterator iterator_to(T& value) noexcept {
+        return iterator(_hook(value));
+    }
+
+    const_iterator iterator_to(const T& value) const noexcept {
+        return const_iterator(_hook(const_cast<T&>(value)));
+    }
+
+    iterator begin() noexcept {
+        return iterator(_sentinel._next);
+    }
+
+    iterator end() noexcept {
+        return iterator(&_sentinel);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(_sentinel._next);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(const_cast<list_hook_base*>(&_sentinel));
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    friend void swap(intrusive_list& first, intrusive_list& second) noexcept {
+        _swap(first, second);
+    }
+
+private:
+    static void _swap(intrusive_list& first, intrusive_list& second) noexcept {
+        // The neighbours of each sentinel have to be pointed at the other sentinel.
+        auto adopt{[](list_hook_base& into, list_hook_base* head, list_hook_base* tail,
+                      list_hook_base* old_sentinel) {
+            if (head == old_sentinel) {
+                into._prev = &into;
+                into._next = &into;
+                return;
+            }
+            into._next = head;
+            into._prev = tail;
+            head->_prev = &into;
+            tail->_next = &into;
+        }};
+
+        auto* first_head{first._sentinel._next};
+        auto* first_tail{first._sentinel._prev};
+        auto* second_head{second._sentinel._next};
+        auto* second_tail{second._sentinel._prev};
+
+        adopt(first._sentinel, second_head, second_tail, &second._sentinel);
+        adopt(second._sentinel, first_head, first_tail, &first._sentinel);
+        std::swap(first._size, second._size);
+    }
+
+    static list_hook_base* _hook(T& value) noexcept {
+        return static_cast<list_hook_base*>(&(value.*Hook));
+    }
+
+    // Recovers the object from its hook. The probe address is never dereferenced; it only lets the
+    // compiler fold the member offset.
+    static T* _owner(list_hook_base* node) noexcept {
+        auto* probe{reinterpret_cast<T*>(alignof(T) * 64)};
+        const auto offset{reinterpret_cast<char*>(&(probe->*Hook)) -
+                          reinterpret_cast<char*>(probe)};
+        auto* hook{reinterpret_cast<char*>(static_cast<hook_type*>(node))};
+        return reinterpret_cast<T*>(hook - offset);
+    }
+
+    list_hook_base _sentinel{};
+    size_t _size{};
+};
+
+template<typename T, auto Hook>
+template<bool Const>
+class intrusive_list<T, Hook>::basic_iterator {
+    friend class intrusive_list;
+    template<bool> friend class basic_iterator;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    basic_iterator() = default;
+
+    // iterator converts to const_iterator, not the other way around.
+    template<bool OtherConst>
+        requires(Const && !OtherConst)
+    basic_iterator(const basic_iterator<OtherConst>& other) : _node{other._node} {}
+
+    reference operator*() const {
+        return *_owner(_node);
+    }
+
+    pointer operator->() const {
+        return _owner(_node);
+    }
+
+    basic_iterator& operator++() {
+        _node = _node->_next;
+        return *this;
+    }
+
+    basic_iterator operator++(int) {
+        auto temp{*this};
+        ++(*this);
+        return temp;
+    }
+
+    basic_iterator& operator--() {
+        _node = _node->_prev;
+        return *this;
+    }
+
+    basic_iterator operator--(int) {
+        auto temp{*this};
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const basic_iterator& other) const = default;
+
+private:
+    explicit basic_iterator(list_hook_base* node) : _node{node} {}
+
+    list_hook_base* _node{};
+};
+
+} // namespace nstd
+
+#endif // NSTD_INTRUSIVE_LIST_HPP
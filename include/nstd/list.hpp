@@ -1,33 +1,57 @@
 #ifndef NSTD_LIST_HPP
 #define NSTD_LIST_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <utility>
 
+#include "nstd/pool_allocator.hpp"
+
 namespace nstd {
-template<typename T> class list {
+// Nodes are allocated through Allocator rebound to the node type. The default pool_allocator packs
+// them into shared per-type chunks; any standard allocator (std::allocator, arena_allocator, ...)
+// works as well.
+template<typename T, typename Allocator = pool_allocator<T>> class list {
     struct Node {
-        T val{};
+        template<typename... Args>
+        explicit Node(Args&&... args) : val(std::forward<Args>(args)...) {}
+
+        T val;
         Node* prev{};
         Node* next{};
     };
 
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
 public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
     class iterator;
     class const_iterator;
 
     list() = default;
+    explicit list(const Allocator& alloc) noexcept;
 
     list(const list& other);
     list(list&& other) noexcept;
-    list& operator=(list other);
+    list& operator=(const list& other);
+    list& operator=(list&& other) noexcept(
+        node_traits::propagate_on_container_move_assignment::value ||
+        node_traits::is_always_equal::value);
     ~list();
 
     void push_front(const T& value);
     void push_front(T&& value);
     void push_back(const T& value);
     void push_back(T&& value);
+    template<typename... Args> T& emplace_front(Args&&... args);
+    template<typename... Args> T& emplace_back(Args&&... args);
     void pop_front();
     void pop_back();
     T& front();
@@ -37,9 +61,41 @@ public:
     bool empty() const noexcept;
     size_t size() const noexcept;
     void clear();
+    // Walk from whichever end is nearer; inserting at size() and erasing the last element are O(1).
     void insert(size_t pos, const T& value);
     void erase(size_t pos);
 
+    // Constant time: the position is already known, nothing is walked.
+    iterator insert(const_iterator pos, const T& value);
+    iterator insert(const_iterator pos, T&& value);
+    template<typename... Args> iterator emplace(const_iterator pos, Args&&... args);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+
+    // Moves nodes from `other` in front of `pos` without allocating or copying. The whole-list and
+    // single-node forms are O(1); the range form is linear in the range length (to keep size()
+    // O(1)). Both lists must use equal allocators.
+    void splice(const_iterator pos, list& other);
+    void splice(const_iterator pos, list&& other);
+    void splice(const_iterator pos, list& other, const_iterator it);
+    void splice(const_iterator pos, list& other, const_iterator first, const_iterator last);
+
+    // Node relinking operations: elements are never copied or moved, only the links change.
+    // sort is a stable bottom-up merge sort, merge requires both lists to be sorted and use equal
+    // allocators. unique and remove* return the number of erased elements.
+    void sort();
+    template<typename Compare> void sort(Compare comp);
+    void merge(list& other);
+    void merge(list&& other);
+    template<typename Compare> void merge(list& other, Compare comp);
+    template<typename Compare> void merge(list&& other, Compare comp);
+    size_t unique();
+    template<typename BinaryPredicate> size_t unique(BinaryPredicate pred);
+    size_t remove(const T& value);
+    template<typename Predicate> size_t remove_if(Predicate pred);
+
+    Allocator get_allocator() const noexcept;
+
     iterator begin();
     iterator end();
     const_iterator begin() const;
@@ -47,22 +103,48 @@ public:
     const_iterator cbegin() const;
     const_iterator cend() const;
 
+    // Allocators are only exchanged when they propagate on swap, otherwise they must compare equal.
     friend void swap(list& first, list& second) noexcept {
+        if constexpr (node_traits::propagate_on_container_swap::value) {
+            std::swap(first._alloc, second._alloc);
+        } else {
+            assert(first._alloc == second._alloc);
+        }
         std::swap(first.head, second.head);
         std::swap(first.tail, second.tail);
         std::swap(first._size, second._size);
     }
 
 private:
+    template<typename... Args> Node* _create_node(Args&&... args);
+    void _destroy_node(Node* node) noexcept;
+
+    // Node at index `pos` (below _size), reached from the nearer end.
+    Node* _node_at(size_t pos) const noexcept;
+    // Unlinks [first, last] (both inclusive, non-null) from this list without touching _size.
+    void _unlink(Node* first, Node* last) noexcept;
+    // Links the chain [first, last] in front of `pos` (nullptr means at the end).
+    void _link_before(Node* pos, Node* first, Node* last) noexcept;
+
+    // Merges the sorted chain `from` into the sorted chain `into` (both linked through `next`
+    // only); ties keep `into` first. If comp throws, `into` still holds every node, unsorted.
+    template<typename Compare> static void _merge_chains(Node*& into, Node* from, Compare& comp);
+    // Installs a `next`-linked chain as the list content, restoring `prev` and `tail`.
+    void _adopt_chain(Node* first) noexcept;
+
     Node* head{};
     Node* tail{};
     size_t _size{};
+    [[no_unique_address]] node_allocator _alloc{};
 };
 
-template<typename T> class list<T>::iterator {
+template<typename T, typename Allocator> class list<T, Allocator>::iterator {
+    friend class list;
+    friend class const_iterator;
+
 public:
     iterator() = default;
-    iterator(Node* node) : _node{node} {}
+    explicit iterator(Node* node) : _node{node} {}
 
     T& operator*() {
         return _node->val;
@@ -100,10 +182,13 @@ private:
     Node* _node{};
 };
 
-template<typename T> class list<T>::const_iterator {
+template<typename T, typename Allocator> class list<T, Allocator>::const_iterator {
+    friend class list;
+
 public:
     const_iterator() = default;
-    const_iterator(Node* node) : _node{node} {}
+    explicit const_iterator(Node* node) : _node{node} {}
+    const_iterator(const iterator& it) : _node{it._node} {}
 
     const T& operator*() const {
         return _node->val;
@@ -141,99 +226,117 @@ private:
     Node* _node{};
 };
 
-template<typename T> list<T>::list(const list& other) : head(nullptr), tail(nullptr) {
+template<typename T, typename Allocator>
+list<T, Allocator>::list(const Allocator& alloc) noexcept : _alloc(alloc) {}
+
+template<typename T, typename Allocator>
+list<T, Allocator>::list(const list& other)
+    : _alloc(node_traits::select_on_container_copy_construction(other._alloc)) {
     if (other.empty()) {
         return;
     }
 
-    auto* cur{other.head};
-    while (cur) {
-        push_back(cur->val);
-        cur = cur->next;
+    try {
+        for (auto* cur{other.head}; cur; cur = cur->next) {
+            push_back(cur->val);
+        }
+    } catch (...) {
+        clear();
+        throw;
     }
 }
 
-template<typename T>
-list<T>::list(list&& other) noexcept : head(other.head), tail(other.tail), _size(other._size) {
+template<typename T, typename Allocator>
+list<T, Allocator>::list(list&& other) noexcept
+    : head(other.head), tail(other.tail), _size(other._size), _alloc(std::move(other._alloc)) {
     other.head = nullptr;
     other.tail = nullptr;
     other._size = 0;
 }
 
-template<typename T> list<T>& list<T>::operator=(list other) {
-    swap(*this, other);
+template<typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(const list& other) {
+    if (this != &other) {
+        // Our nodes have to go back to the allocator that handed them out.
+        clear();
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+            _alloc = other._alloc;
+        }
+
+        for (auto* cur{other.head}; cur; cur = cur->next) {
+            push_back(cur->val);
+        }
+    }
     return *this;
 }
 
-template<typename T> list<T>::~list() {
-    clear();
-}
-
-template<typename T> void list<T>::push_front(const T& value) {
-    auto* new_node{new Node{value, nullptr, nullptr}};
-
-    if (head == nullptr) {
-        head = new_node;
-        tail = new_node;
-        ++_size;
-        return;
+template<typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(list&& other) noexcept(
+    node_traits::propagate_on_container_move_assignment::value ||
+    node_traits::is_always_equal::value) {
+    if (this != &other) {
+        clear();
+
+        if constexpr (!node_traits::propagate_on_container_move_assignment::value &&
+                      !node_traits::is_always_equal::value) {
+            // The nodes belong to an allocator we can not take over, so move element by element.
+            if (_alloc != other._alloc) {
+                for (auto* cur{other.head}; cur; cur = cur->next) {
+                    push_back(std::move(cur->val));
+                }
+                other.clear();
+                return *this;
+            }
+        }
+
+        if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+            _alloc = std::move(other._alloc);
+        }
+
+        head = other.head;
+        tail = other.tail;
+        _size = other._size;
+
+        other.head = nullptr;
+        other.tail = nullptr;
+        other._size = 0;
     }
-
-    new_node->next = head;
-    head->prev = new_node;
-    head = new_node;
-    ++_size;
+    return *this;
 }
 
-template<typename T> void list<T>::push_front(T&& value) {
-    auto* new_node{new Node{std::move(value), nullptr, nullptr}};
-
-    if (head == nullptr) {
-        head = new_node;
-        tail = new_node;
-        ++_size;
-        return;
-    }
-
-    new_node->next = head;
-    head->prev = new_node;
-    head = new_node;
-    ++_size;
+template<typename T, typename Allocator> list<T, Allocator>::~list() {
+    clear();
 }
 
-template<typename T> void list<T>::push_back(const T& value) {
-    auto* new_node{new Node{value, nullptr, nullptr}};
+template<typename T, typename Allocator> void list<T, Allocator>::push_front(const T& value) {
+    emplace_front(value);
+}
 
-    if (head == nullptr) {
-        head = new_node;
-        tail = new_node;
-        ++_size;
-        return;
-    }
+template<typename T, typename Allocator> void list<T, Allocator>::push_front(T&& value) {
+    emplace_front(std::move(value));
+}
 
-    tail->next = new_node;
-    new_node->prev = tail;
-    tail = new_node;
-    ++_size;
+template<typename T, typename Allocator> void list<T, Allocator>::push_back(const T& value) {
+    emplace_back(value);
 }
 
-template<typename T> void list<T>::push_back(T&& value) {
-    auto* new_node{new Node{std::move(value), nullptr, nullptr}};
+template<typename T, typename Allocator> void list<T, Allocator>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
 
-    if (head == nullptr) {
-        head = new_node;
-        tail = new_node;
-        ++_size;
-        return;
-    }
+template<typename T, typename Allocator>
+template<typename... Args>
+T& list<T, Allocator>::emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+}
 
-    tail->next = new_node;
-    new_node->prev = tail;
-    tail = new_node;
-    ++_size;
+template<typename T, typename Allocator>
+template<typename... Args>
+T& list<T, Allocator>::emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
 }
 
-template<typename T> void list<T>::pop_front() {
+template<typename T, typename Allocator> void list<T, Allocator>::pop_front() {
     if (!head) {
         return;
     }
@@ -248,11 +351,11 @@ template<typename T> void list<T>::pop_front() {
         head->prev = nullptr;
     }
 
-    delete temp;
+    _destroy_node(temp);
     --_size;
 }
 
-template<typename T> void list<T>::pop_back() {
+template<typename T, typename Allocator> void list<T, Allocator>::pop_back() {
     if (!head) {
         return;
     }
@@ -267,44 +370,44 @@ template<typename T> void list<T>::pop_back() {
         tail->next = nullptr;
     }
 
-    delete temp;
+    _destroy_node(temp);
     --_size;
 }
 
-template<typename T> T& list<T>::front() {
+template<typename T, typename Allocator> T& list<T, Allocator>::front() {
     assert(head);
     return head->val;
 }
 
-template<typename T> const T& list<T>::front() const {
+template<typename T, typename Allocator> const T& list<T, Allocator>::front() const {
     assert(head);
     return head->val;
 }
 
-template<typename T> T& list<T>::back() {
+template<typename T, typename Allocator> T& list<T, Allocator>::back() {
     assert(tail);
     return tail->val;
 }
 
-template<typename T> const T& list<T>::back() const {
+template<typename T, typename Allocator> const T& list<T, Allocator>::back() const {
     assert(tail);
     return tail->val;
 }
 
-template<typename T> bool list<T>::empty() const noexcept {
+template<typename T, typename Allocator> bool list<T, Allocator>::empty() const noexcept {
     return _size == 0;
 }
 
-template<typename T> size_t list<T>::size() const noexcept {
+template<typename T, typename Allocator> size_t list<T, Allocator>::size() const noexcept {
     return _size;
 }
 
-template<typename T> void list<T>::clear() {
+template<typename T, typename Allocator> void list<T, Allocator>::clear() {
 
     while (head) {
         auto* temp{head};
         head = head->next;
-        delete temp;
+        _destroy_node(temp);
     }
 
     head = nullptr;
@@ -312,81 +415,437 @@ template<typename T> void list<T>::clear() {
     _size = 0;
 }
 
-template<typename T> void list<T>::insert(size_t pos, const T& value) {
+template<typename T, typename Allocator>
+void list<T, Allocator>::insert(size_t pos, const T& value) {
     assert(pos <= _size);
 
-    if (pos == 0) {
-        push_front(value);
+    if (pos == _size) {
+        push_back(value);
         return;
     }
 
-    if (pos == _size) {
-        push_back(value);
+    insert(const_iterator{_node_at(pos)}, value);
+}
+
+template<typename T, typename Allocator> void list<T, Allocator>::erase(size_t pos) {
+    assert(pos < _size);
+
+    if (pos == _size - 1) {
+        pop_back();
         return;
     }
 
-    auto* cur{head};
-    for (size_t i{}; i < pos - 1; ++i) {
-        cur = cur->next;
+    erase(const_iterator{_node_at(pos)});
+}
+
+template<typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(const_iterator pos,
+                                                                 const T& value) {
+    return emplace(pos, value);
+}
+
+template<typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(const_iterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename list<T, Allocator>::iterator list<T, Allocator>::emplace(const_iterator pos,
+                                                                  Args&&... args) {
+    auto* new_node{_create_node(std::forward<Args>(args)...)};
+    _link_before(pos._node, new_node, new_node);
+    ++_size;
+    return iterator(new_node);
+}
+
+template<typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::erase(const_iterator pos) {
+    auto* node{pos._node};
+    assert(node);
+
+    auto* next{node->next};
+    _unlink(node, node);
+    _destroy_node(node);
+    --_size;
+    return iterator(next);
+}
+
+template<typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::erase(const_iterator first,
+                                                                const_iterator last) {
+    while (first != last) {
+        first = erase(first);
     }
+    return iterator(last._node);
+}
+
+template<typename T, typename Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other) {
+    assert(_alloc == other._alloc);
+    if (this == &other || other.empty()) {
+        return;
+    }
+
+    _link_before(pos._node, other.head, other.tail);
+    _size += other._size;
 
-    auto* new_node{new Node{value, nullptr, nullptr}};
+    other.head = nullptr;
+    other.tail = nullptr;
+    other._size = 0;
+}
 
-    new_node->next = cur->next;
-    new_node->prev = cur;
+template<typename T, typename Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list&& other) {
+    splice(pos, other);
+}
 
-    cur->next = new_node;
-    new_node->next->prev = new_node;
+template<typename T, typename Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other, const_iterator it) {
+    assert(_alloc == other._alloc);
+    auto* node{it._node};
+    assert(node);
+    if (this == &other && (node == pos._node || node->next == pos._node)) {
+        return;
+    }
 
+    other._unlink(node, node);
+    --other._size;
+    _link_before(pos._node, node, node);
     ++_size;
 }
 
-template<typename T> void list<T>::erase(size_t pos) {
-    assert(pos < _size);
+template<typename T, typename Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other, const_iterator first,
+                                const_iterator last) {
+    assert(_alloc == other._alloc);
+    if (first == last) {
+        return;
+    }
+
+    size_t count{1};
+    auto* back{first._node};
+    while (back->next != last._node) {
+        back = back->next;
+        ++count;
+    }
+
+    other._unlink(first._node, back);
+    other._size -= count;
+    _link_before(pos._node, first._node, back);
+    _size += count;
+}
 
-    if (pos == 0) {
-        pop_front();
+template<typename T, typename Allocator> void list<T, Allocator>::sort() {
+    sort(std::less<>{});
+}
+
+template<typename T, typename Allocator>
+template<typename Compare>
+void list<T, Allocator>::sort(Compare comp) {
+    if (_size < 2) {
         return;
     }
 
-    if (pos == _size - 1) {
-        pop_back();
+    // bins[i] holds a sorted run of 2^i nodes (or nothing), like the digits of a binary counter.
+    // Higher bins always hold earlier elements, which keeps the sort stable.
+    constexpr size_t bin_count{64};
+    Node* bins[bin_count]{};
+    size_t used{};
+    Node* cur{head};
+
+    try {
+        while (cur) {
+            Node* carry{cur};
+            cur = cur->next;
+            carry->next = nullptr;
+
+            size_t i{};
+            for (; i < used && bins[i]; ++i) {
+                _merge_chains(bins[i], carry, comp);
+                carry = bins[i];
+                bins[i] = nullptr;
+            }
+            bins[i] = carry;
+            used = std::max(used, i + 1);
+        }
+
+        for (size_t i{1}; i < used; ++i) {
+            // Taken out of its bin first: a throwing merge leaves every node in bins[i].
+            Node* lower{bins[i - 1]};
+            bins[i - 1] = nullptr;
+            if (!lower) {
+                continue;
+            }
+            if (bins[i]) {
+                _merge_chains(bins[i], lower, comp);
+            } else {
+                bins[i] = lower;
+            }
+        }
+    } catch (...) {
+        // Every node is in some bin or still in the unsorted rest; keep them all, in any order.
+        Node* all{cur};
+        for (size_t i{}; i < used; ++i) {
+            for (Node* node{bins[i]}; node;) {
+                Node* next{node->next};
+                node->next = all;
+                all = node;
+                node = next;
+            }
+        }
+        _adopt_chain(all);
+        throw;
+    }
+
+    _adopt_chain(bins[used - 1]);
+}
+
+template<typename T, typename Allocator> void list<T, Allocator>::merge(list& other) {
+    merge(other, std::less<>{});
+}
+
+template<typename T, typename Allocator> void list<T, Allocator>::merge(list&& other) {
+    merge(other, std::less<>{});
+}
+
+template<typename T, typename Allocator>
+template<typename Compare>
+void list<T, Allocator>::merge(list& other, Compare comp) {
+    assert(_alloc == other._alloc);
+    if (this == &other || other.empty()) {
         return;
     }
 
+    Node* merged{head};
+    Node* from{other.head};
+    head = nullptr;
+    other.head = nullptr;
+    other.tail = nullptr;
+    _size += other._size;
+    other._size = 0;
+
+    // On a throwing comparison every node still ends up here; only the order is unspecified.
+    try {
+        _merge_chains(merged, from, comp);
+    } catch (...) {
+        _adopt_chain(merged);
+        throw;
+    }
+    _adopt_chain(merged);
+}
+
+template<typename T, typename Allocator>
+template<typename Compare>
+void list<T, Allocator>::merge(list&& other, Compare comp) {
+    merge(other, std::move(comp));
+}
+
+template<typename T, typename Allocator> size_t list<T, Allocator>::unique() {
+    return unique(std::equal_to<>{});
+}
+
+template<typename T, typename Allocator>
+template<typename BinaryPredicate>
+size_t list<T, Allocator>::unique(BinaryPredicate pred) {
+    // Duplicates are compared against the first element of their run, as std::list does.
+    size_t removed{};
+    for (Node* first{head}; first;) {
+        Node* next{first->next};
+        if (next && pred(first->val, next->val)) {
+            _unlink(next, next);
+            _destroy_node(next);
+            ++removed;
+        } else {
+            first = next;
+        }
+    }
+
+    _size -= removed;
+    return removed;
+}
+
+template<typename T, typename Allocator> size_t list<T, Allocator>::remove(const T& value) {
+    return remove_if([&value](const T& element) { return element == value; });
+}
+
+template<typename T, typename Allocator>
+template<typename Predicate>
+size_t list<T, Allocator>::remove_if(Predicate pred) {
+    // Matches are only unlinked during the walk and destroyed afterwards, so the predicate may
+    // refer to an element of this list (remove(front()) is valid).
+    Node* doomed{};
+    size_t removed{};
+    for (Node* cur{head}; cur;) {
+        Node* next{cur->next};
+        if (pred(cur->val)) {
+            _unlink(cur, cur);
+            cur->next = doomed;
+            doomed = cur;
+            ++removed;
+        }
+        cur = next;
+    }
+
+    while (doomed) {
+        Node* next{doomed->next};
+        _destroy_node(doomed);
+        doomed = next;
+    }
+
+    _size -= removed;
+    return removed;
+}
+
+template<typename T, typename Allocator>
+Allocator list<T, Allocator>::get_allocator() const noexcept {
+    return Allocator(_alloc);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename list<T, Allocator>::Node* list<T, Allocator>::_create_node(Args&&... args) {
+    auto* node{node_traits::allocate(_alloc, 1)};
+    try {
+        node_traits::construct(_alloc, node, std::forward<Args>(args)...);
+    } catch (...) {
+        node_traits::deallocate(_alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void list<T, Allocator>::_destroy_node(Node* node) noexcept {
+    node_traits::destroy(_alloc, node);
+    node_traits::deallocate(_alloc, node, 1);
+}
+
+template<typename T, typename Allocator>
+void list<T, Allocator>::_unlink(Node* first, Node* last) noexcept {
+    if (first->prev) {
+        first->prev->next = last->next;
+    } else {
+        head = last->next;
+    }
+
+    if (last->next) {
+        last->next->prev = first->prev;
+    } else {
+        tail = first->prev;
+    }
+
+    first->prev = nullptr;
+    last->next = nullptr;
+}
+
+template<typename T, typename Allocator>
+template<typename Compare>
+void list<T, Allocator>::_merge_chains(Node*& into, Node* from, Compare& comp) {
+    Node* a{into};
+    Node* b{from};
+    Node* result{};
+    Node** link{&result};
+
+    try {
+        while (a && b) {
+            if (comp(b->val, a->val)) {
+                *link = b;
+                b = b->next;
+            } else {
+                *link = a;
+                a = a->next;
+            }
+            link = &(*link)->next;
+        }
+    } catch (...) {
+        *link = a;
+        while (*link) {
+            link = &(*link)->next;
+        }
+        *link = b;
+        into = result;
+        throw;
+    }
+
+    *link = a ? a : b;
+    into = result;
+}
+
+template<typename T, typename Allocator>
+void list<T, Allocator>::_adopt_chain(Node* first) noexcept {
+    head = first;
+    tail = nullptr;
+    for (Node* cur{first}; cur; cur = cur->next) {
+        cur->prev = tail;
+        tail = cur;
+    }
+}
+
+template<typename T, typename Allocator>
+typename list<T, Allocator>::Node* list<T, Allocator>::_node_at(size_t pos) const noexcept {
+    if (pos > _size / 2) {
+        auto* cur{tail};
+        for (size_t i{_size - 1}; i > pos; --i) {
+            cur = cur->prev;
+        }
+        return cur;
+    }
+
     auto* cur{head};
     for (size_t i{}; i < pos; ++i) {
         cur = cur->next;
     }
+    return cur;
+}
 
-    cur->prev->next = cur->next;
-    cur->next->prev = cur->prev;
+template<typename T, typename Allocator>
+void list<T, Allocator>::_link_before(Node* pos, Node* first, Node* last) noexcept {
+    Node* before{pos ? pos->prev : tail};
 
-    delete cur;
-    --_size;
+    first->prev = before;
+    last->next = pos;
+
+    if (before) {
+        before->next = first;
+    } else {
+        head = first;
+    }
+
+    if (pos) {
+        pos->prev = last;
+    } else {
+        tail = last;
+    }
 }
 
-template<typename T> typename list<T>::iterator list<T>::begin() {
+template<typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::begin() {
     return iterator(head);
 }
 
-template<typename T> typename list<T>::iterator list<T>::end() {
+template<typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::end() {
     return iterator(nullptr);
 }
 
-template<typename T> typename list<T>::const_iterator list<T>::begin() const {
+template<typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::begin() const {
     return const_iterator(head);
 }
 
-template<typename T> typename list<T>::const_iterator list<T>::end() const {
+template<typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::end() const {
     return const_iterator(nullptr);
 }
 
-template<typename T> typename list<T>::const_iterator list<T>::cbegin() const {
+template<typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cbegin() const {
     return const_iterator(head);
 }
 
-template<typename T> typename list<T>::const_iterator list<T>::cend() const {
+template<typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cend() const {
     return const_iterator(nullptr);
 }
 
@@ -2,43 +2,567 @@
 #define NSTD_MEMORY_POOL
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
 #include <new>
-#include <vector>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "nstd/vector.hpp"
 
 namespace nstd {
-template<typename T, size_t BlocksPerChunk = 100> class memory_pool {
+
+// --- Free List Policies ---
+//
+// A free list policy owns the head of the embedded free list. memory_pool only asks it to pop one
+// block, push one block, or push a whole pre-linked chain (a fresh chunk). The first word of every
+// free block holds the pointer to the next free block.
+//
+// mutex_type only guards chunk expansion, which is rare; pop/push never take it. thread_safe
+// policies skip occupancy bookkeeping, so their chunks are only given back by release_all() or
+// the destructor.
+
+struct null_mutex {
+    void lock() noexcept {}
+    void unlock() noexcept {}
+};
+
+// Plain pointer head. Single-threaded, the fastest option and the default.
+class intrusive_free_list {
+public:
+    using mutex_type = null_mutex;
+    static constexpr bool thread_safe{false};
+
+    void* pop() noexcept {
+        void* result{_head};
+        if (result) {
+            _head = *static_cast<void**>(result);
+        }
+        return result;
+    }
+
+    void push(void* block) noexcept {
+        push_chain(block, block);
+    }
+
+    void push_chain(void* first, void* last) noexcept {
+        *static_cast<void**>(last) = _head;
+        _head = first;
+    }
+
+    void clear() noexcept {
+        _head = nullptr;
+    }
+
+private:
+    void* _head{};
+};
+
+// Lock-free Treiber stack. The head is a single atomic word holding the pointer plus a version tag
+// in the spare upper bits (16 bits on 64-bit targets with 48-bit user addresses, 32 bits on 32-bit
+// targets). Every successful CAS bumps the tag, so a head that was popped and pushed back by other
+// threads in the meantime (the ABA problem) no longer compares equal.
+//
+// Reading the next pointer of a block that another thread just popped is harmless: chunks are only
+// returned to the OS by release_all() or the pool destructor, and the stale value is discarded when
+// the CAS fails.
+// ThreadSanitizer still reports it as a race against the new owner's constructor.
+class tagged_free_list {
+    using word = std::uint64_t;
+
+public:
+    using mutex_type = std::mutex;
+    static constexpr bool thread_safe{true};
+
+    void* pop() noexcept {
+        auto old_head{_head.load(std::memory_order_acquire)};
+
+        while (true) {
+            void* node{_pointer(old_head)};
+            if (!node) {
+                return nullptr;
+            }
+
+            void* next{std::atomic_ref<void*>{*static_cast<void**>(node)}.load(
+                std::memory_order_relaxed)};
+
+            if (_head.compare_exchange_weak(old_head, _pack(next, _tag(old_head) + 1),
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire)) {
+                return node;
+            }
+        }
+    }
+
+    void push(void* block) noexcept {
+        push_chain(block, block);
+    }
+
+    void push_chain(void* first, void* last) noexcept {
+        auto old_head{_head.load(std::memory_order_relaxed)};
+        std::atomic_ref<void*> link{*static_cast<void**>(last)};
+
+        do {
+            link.store(_pointer(old_head), std::memory_order_relaxed);
+        } while (!_head.compare_exchange_weak(old_head, _pack(first, _tag(old_head) + 1),
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+
+    void clear() noexcept {
+        _head.store(_pack(nullptr, _tag(_head.load(std::memory_order_relaxed)) + 1),
+                    std::memory_order_release);
+    }
+
+private:
+    static constexpr unsigned pointer_bits{sizeof(void*) == 8 ? 48 : 32};
+    static constexpr word pointer_mask{(word{1} << pointer_bits) - 1};
+
+    static word _pack(void* ptr, word tag) noexcept {
+        auto bits{static_cast<word>(reinterpret_cast<std::uintptr_t>(ptr))};
+        assert((bits & ~pointer_mask) == 0 && "pointer does not fit below the tag bits");
+        return bits | (tag << pointer_bits);
+    }
+
+    static void* _pointer(word packed) noexcept {
+        return reinterpret_cast<void*>(static_cast<std::uintptr_t>(packed & pointer_mask));
+    }
+
+    static word _tag(word packed) noexcept {
+        return packed >> pointer_bits;
+    }
+
+    static_assert(std::atomic<word>::is_always_lock_free, "tagged_free_list needs a lock-free CAS");
+
+    std::atomic<word> _head{};
+};
+
+// --- Chunk Sources ---
+//
+// A chunk source hands memory_pool its raw chunks. round_size() may enlarge a request to whatever
+// the source would reserve anyway; the pool then fills the extra room with blocks.
+
+// Assumed cache line size; blocks aligned to it never share a line with their neighbours.
+inline constexpr size_t cache_line_size{64};
+
+struct heap_chunk_source {
+    static constexpr size_t round_size(size_t bytes) noexcept {
+        return bytes;
+    }
+
+    static void* allocate(size_t bytes, size_t align) {
+        return ::operator new(bytes, std::align_val_t{align});
+    }
+
+    static void deallocate(void* ptr, size_t bytes, size_t align) noexcept {
+        ::operator delete(ptr, bytes, std::align_val_t{align});
+    }
+};
+
+// Backs chunks with 2 MiB aligned anonymous mappings and asks the kernel for transparent huge
+// pages, so a pool of millions of blocks needs a handful of TLB entries instead of thousands.
+// MADV_HUGEPAGE is only advice: without THP support the mapping simply stays on 4 KiB pages.
+// Outside Linux this falls back to the heap.
+struct huge_page_chunk_source {
+    static constexpr size_t huge_page_size{size_t{2} << 20};
+
+    static constexpr size_t round_size(size_t bytes) noexcept {
+        return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+    }
+
+#if defined(__linux__)
+    static void* allocate(size_t bytes, size_t align) {
+        if (align > huge_page_size) {
+            throw std::bad_alloc{};
+        }
+
+        // Over-map by one huge page, then cut the misaligned head and the unused tail.
+        const size_t mapped{bytes + huge_page_size};
+        void* raw{::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1,
+                         0)};
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc{};
+        }
+
+        auto* begin{static_cast<char*>(raw)};
+        const auto address{reinterpret_cast<std::uintptr_t>(begin)};
+        auto* aligned{
+            reinterpret_cast<char*>((address + huge_page_size - 1) & ~(huge_page_size - 1))};
+        if (aligned != begin) {
+            ::munmap(begin, static_cast<size_t>(aligned - begin));
+        }
+        if (const size_t tail{static_cast<size_t>(begin + mapped - (aligned + bytes))}; tail) {
+            ::munmap(aligned + bytes, tail);
+        }
+
+        ::madvise(aligned, bytes, MADV_HUGEPAGE);
+        return aligned;
+    }
+
+    static void deallocate(void* ptr, size_t bytes, size_t) noexcept {
+        ::munmap(ptr, bytes);
+    }
+#else
+    static void* allocate(size_t bytes, size_t align) {
+        return heap_chunk_source::allocate(bytes, align);
+    }
+
+    static void deallocate(void* ptr, size_t bytes, size_t align) noexcept {
+        heap_chunk_source::deallocate(ptr, bytes, align);
+    }
+#endif
+};
+
+// --- Instrumentation Policies ---
+//
+// memory_pool calls the instrumentation hooks only when `enabled` is true, so the default
+// no_instrumentation compiles down to the plain pool.
+//
+// pool_instrumentation is the debug policy. It keeps a shadow bitmap with one bit per block
+// (set while the block is live), which catches double frees and pointers that never came from the
+// pool before the destructor runs. Free blocks are filled with poison_byte; a block whose poison
+// was overwritten by the time it is handed out again (or the pool dies) was written after free.
+// The embedded next pointer lives in the first word, so only the bytes after it are checked.
+// Whatever is still live when the pool is destroyed is reported as a leak.
+//
+// Defining NSTD_INSTRUMENT_POOLS makes pool_instrumentation the default for every pool. All
+// translation units of a program must agree on it.
+
+struct no_instrumentation {
+    static constexpr bool enabled{false};
+};
+
+enum class pool_error { double_free, foreign_pointer, use_after_free, leak };
+
+class pool_instrumentation {
+    struct chunk_shadow {
+        char* begin{};
+        size_t blocks{};
+        nstd::vector<std::uint64_t> live_bits{};
+    };
+
+public:
+    static constexpr bool enabled{true};
+    static constexpr unsigned char poison_byte{0xDD};
+
+    struct statistics {
+        size_t live{};
+        size_t peak{};
+        size_t chunks{};
+        size_t allocations{};
+        size_t deallocations{};
+    };
+
+    static void default_handler(pool_error error, const void* block, size_t count) {
+        switch (error) {
+        case pool_error::double_free:
+            std::fprintf(stderr, "nstd::memory_pool: double free of %p\n", block);
+            break;
+        case pool_error::foreign_pointer:
+            std::fprintf(stderr, "nstd::memory_pool: %p was not allocated by this pool\n", block);
+            break;
+        case pool_error::use_after_free:
+            std::fprintf(stderr, "nstd::memory_pool: block %p was written after free\n", block);
+            break;
+        case pool_error::leak:
+            std::fprintf(stderr, "nstd::memory_pool: %zu block(s) leaked, first at %p\n", count,
+                         block);
+            return;
+        }
+        std::abort();
+    }
+
+    // Receives every detected error. The default prints it and aborts; for leaks it only prints.
+    using error_handler = void (*)(pool_error error, const void* block, size_t count);
+    static inline error_handler handler{&default_handler};
+
+    statistics stats() const {
+        std::lock_guard lock{_mtx};
+        return _stats;
+    }
+
+    void on_chunk_added(char* begin, size_t blocks, size_t block_size) {
+        std::lock_guard lock{_mtx};
+        _block_size = block_size;
+        std::memset(begin, poison_byte, blocks * block_size);
+        _chunks.push_back(
+            chunk_shadow{begin, blocks, nstd::vector<std::uint64_t>((blocks + 63) / 64)});
+        ++_stats.chunks;
+    }
+
+    void on_chunk_released(char* begin) {
+        std::lock_guard lock{_mtx};
+        for (size_t i{}; i < _chunks.size(); ++i) {
+            if (_chunks[i].begin == begin) {
+                _chunks.erase(_chunks.begin() + i);
+                --_stats.chunks;
+                return;
+            }
+        }
+    }
+
+    // Called before the object is constructed in `block`.
+    void on_allocate(void* block) {
+        std::lock_guard lock{_mtx};
+        auto [shadow, index]{_locate(block)};
+        if (!shadow) {
+            // A block from outside the pool means a stale write corrupted a free list link.
+            handler(pool_error::use_after_free, block, 1);
+            return;
+        }
+        if (!_poison_intact(block)) {
+            handler(pool_error::use_after_free, block, 1);
+        }
+        shadow->live_bits[index / 64] |= std::uint64_t{1} << (index % 64);
+
+        ++_stats.allocations;
+        _stats.peak = std::max(_stats.peak, ++_stats.live);
+    }
+
+    // Called before the object in `block` is destroyed. The pool must not free the block when
+    // this returns false.
+    bool on_deallocate(void* block) {
+        std::lock_guard lock{_mtx};
+        auto [shadow, index]{_locate(block)};
+        if (!shadow) {
+            handler(pool_error::foreign_pointer, block, 1);
+            return false;
+        }
+
+        auto& word{shadow->live_bits[index / 64]};
+        const std::uint64_t bit{std::uint64_t{1} << (index % 64)};
+        if (!(word & bit)) {
+            handler(pool_error::double_free, block, 1);
+            return false;
+        }
+        word &= ~bit;
+
+        ++_stats.deallocations;
+        --_stats.live;
+        return true;
+    }
+
+    // Called once the block is dead, before it goes back on the free list.
+    void on_freed(void* block) noexcept {
+        std::memset(block, poison_byte, _block_size);
+    }
+
+    void on_release_all() {
+        std::lock_guard lock{_mtx};
+        for (auto& shadow : _chunks) {
+            std::memset(shadow.begin, poison_byte, shadow.blocks * _block_size);
+            std::fill(shadow.live_bits.begin(), shadow.live_bits.end(), std::uint64_t{0});
+        }
+        _stats.live = 0;
+    }
+
+    // Called by the pool destructor while the chunks still exist.
+    void on_destroy() {
+        std::lock_guard lock{_mtx};
+        const void* first_leak{};
+        for (auto& shadow : _chunks) {
+            for (size_t i{}; i < shadow.blocks; ++i) {
+                void* block{shadow.begin + i * _block_size};
+                if (shadow.live_bits[i / 64] & (std::uint64_t{1} << (i % 64))) {
+                    first_leak = first_leak ? first_leak : block;
+                } else if (!_poison_intact(block)) {
+                    handler(pool_error::use_after_free, block, 1);
+                }
+            }
+        }
+
+        if (_stats.live) {
+            handler(pool_error::leak, first_leak, _stats.live);
+        }
+    }
+
+private:
+    struct location {
+        chunk_shadow* shadow{};
+        size_t index{};
+    };
+
+    location _locate(void* block) {
+        auto* address{static_cast<char*>(block)};
+        for (auto& shadow : _chunks) {
+            if (address >= shadow.begin && address < shadow.begin + shadow.blocks * _block_size) {
+                const auto offset{static_cast<size_t>(address - shadow.begin)};
+                if (offset % _block_size) {
+                    return {};
+                }
+                return {&shadow, offset / _block_size};
+            }
+        }
+        return {};
+    }
+
+    bool _poison_intact(void* block) const noexcept {
+        const auto* bytes{static_cast<const unsigned char*>(block)};
+        for (size_t i{sizeof(void*)}; i < _block_size; ++i) {
+            if (bytes[i] != poison_byte) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    mutable std::mutex _mtx{};
+    nstd::vector<chunk_shadow> _chunks{};
+    size_t _block_size{};
+    statistics _stats{};
+};
+
+#if defined(NSTD_INSTRUMENT_POOLS)
+using default_pool_instrumentation = pool_instrumentation;
+#else
+using default_pool_instrumentation = no_instrumentation;
+#endif
+
+// --- Memory Pool ---
+//
+// Chunks grow geometrically (each new chunk roughly doubles the pool) and are carved lazily: a
+// block is only handed out from the untouched tail of a chunk once the free list is empty, so
+// creating a chunk and release_all() cost O(1) per chunk instead of O(blocks).
+//
+// With a single-threaded free list the pool also tracks how many blocks are live. Once less than
+// a third of the pool is in use, deallocate() runs a trim: it counts the free blocks of each chunk
+// and gives fully free chunks back to the system, keeping as much free headroom as there are live
+// blocks. The gap between the trim trigger and the headroom it leaves is the hysteresis that stops
+// a steady alloc/free pattern from thrashing chunks.
+//
+// Every block is aligned to BlockAlign, which defaults to alignof(T). Passing cache_line_size pads
+// each block to its own cache line so objects used by different threads never falsely share one.
+
+template<typename T, size_t BlocksPerChunk = 100, typename FreeList = intrusive_free_list,
+         size_t BlockAlign = alignof(T), typename ChunkSource = heap_chunk_source,
+         typename Instrumentation = default_pool_instrumentation>
+class memory_pool {
+    static_assert(BlocksPerChunk > 0, "BlocksPerChunk must be greater than 0");
+    static_assert(std::has_single_bit(BlockAlign), "BlockAlign must be a power of two");
+    static_assert(BlockAlign >= alignof(T), "BlockAlign must not weaken alignof(T)");
+
+    struct chunk {
+        char* begin{};
+        size_t bytes{};
+        size_t blocks{};
+        size_t carved{};
+        size_t scratch{};
+    };
+
 public:
     memory_pool() {
         _expand();
     }
 
     template<typename... Args> T* allocate(Args&&... args) {
-        if (!_head) {
-            _expand();
+        void* result{_free_list.pop()};
+        if (!result) {
+            result = _carve();
         }
-        void* result{_head};
-        _head = *reinterpret_cast<void**>(_head);
+
+        if constexpr (Instrumentation::enabled) {
+            _instrumentation.on_allocate(result);
+        }
+
         try {
-            return new (result) T(std::forward<Args>(args)...);
+            result = new (result) T(std::forward<Args>(args)...);
         } catch (...) {
-            *reinterpret_cast<void**>(result) = _head;
-            _head = result;
+            if constexpr (Instrumentation::enabled) {
+                _instrumentation.on_deallocate(result);
+                _instrumentation.on_freed(result);
+            }
+            _free_list.push(result);
             throw;
         }
+
+        if constexpr (!FreeList::thread_safe) {
+            ++_live;
+        }
+
+        return static_cast<T*>(result);
     }
 
     void deallocate(T* ptr) {
         if (!ptr) {
             return;
         }
+        if constexpr (Instrumentation::enabled) {
+            if (!_instrumentation.on_deallocate(ptr)) {
+                return;
+            }
+        }
         ptr->~T();
-        *reinterpret_cast<void**>(ptr) = _head;
-        _head = ptr;
+        if constexpr (Instrumentation::enabled) {
+            _instrumentation.on_freed(ptr);
+        }
+        _free_list.push(ptr);
+
+        if constexpr (!FreeList::thread_safe) {
+            --_live;
+            const size_t free_blocks{_capacity - _live};
+            if (free_blocks > 2 * _live + BlocksPerChunk && _live <= _retrim_below) {
+                _trim(_live);
+            }
+        }
+    }
+
+    // Forget every object at once. No destructor runs, so T must be trivially destructible.
+    // Chunks are kept for reuse; call trim() afterwards to return them to the system.
+    void release_all() noexcept
+        requires std::is_trivially_destructible_v<T>
+    {
+        std::lock_guard lock{_expand_mtx};
+
+        _free_list.clear();
+        if constexpr (Instrumentation::enabled) {
+            _instrumentation.on_release_all();
+        }
+        for (auto& c : _chunks) {
+            c.carved = 0;
+        }
+        _carve_index = 0;
+        _live = 0;
+        _retrim_below = no_limit;
+    }
+
+    // Give every fully free chunk back to the system, ignoring hysteresis.
+    void trim()
+        requires(!FreeList::thread_safe)
+    {
+        _trim(0);
+    }
+
+    // Number of blocks owned by the pool, live or free.
+    size_t capacity() const noexcept {
+        return _capacity;
+    }
+
+    size_t chunk_count() const noexcept {
+        return _chunks.size();
+    }
+
+    // Counters and the shadow state of an instrumented pool.
+    const Instrumentation& instrumentation() const noexcept
+        requires Instrumentation::enabled
+    {
+        return _instrumentation;
     }
 
     ~memory_pool() {
-        for (auto* chunk : _chunks) {
-            ::operator delete(chunk);
+        if constexpr (Instrumentation::enabled) {
+            _instrumentation.on_destroy();
+        }
+        for (auto& c : _chunks) {
+            ChunkSource::deallocate(c.begin, c.bytes, block_align);
         }
     }
 
@@ -46,25 +570,143 @@ public:
     memory_pool& operator=(const memory_pool&) = delete;
 
 private:
+    // Slow path: hand out the next never-used block, growing the pool if every chunk is carved.
+    void* _carve() {
+        std::lock_guard lock{_expand_mtx};
+
+        while (_carve_index < _chunks.size() &&
+               _chunks[_carve_index].carved == _chunks[_carve_index].blocks) {
+            ++_carve_index;
+        }
+
+        if (_carve_index == _chunks.size()) {
+            _expand();
+        }
+
+        auto& c{_chunks[_carve_index]};
+        return c.begin + (c.carved++ * block_size);
+    }
+
+    // Adds a chunk as large as everything we already own (clamped), doubling the pool.
     void _expand() {
-        auto* const raw_mem{::operator new(block_size* BlocksPerChunk)};
-        _chunks.push_back(raw_mem);
+        const size_t bytes{
+            ChunkSource::round_size(std::clamp(_capacity, BlocksPerChunk, max_blocks_per_chunk) *
+                                    block_size)};
+        const size_t blocks{bytes / block_size};
 
-        char* ptr = static_cast<char*>(raw_mem);
+        auto* const raw_mem{static_cast<char*>(ChunkSource::allocate(bytes, block_align))};
+        try {
+            _chunks.push_back(chunk{raw_mem, bytes, blocks, 0, 0});
+        } catch (...) {
+            ChunkSource::deallocate(raw_mem, bytes, block_align);
+            throw;
+        }
 
-        for (size_t i{}; i < BlocksPerChunk - 1; ++i) {
-            *reinterpret_cast<void**>(ptr + (i * block_size)) = ptr + ((i + 1) * block_size);
+        if constexpr (Instrumentation::enabled) {
+            _instrumentation.on_chunk_added(raw_mem, blocks, block_size);
         }
 
-        *reinterpret_cast<void**>(ptr + ((BlocksPerChunk - 1) * block_size)) = _head;
-        _head = raw_mem;
+        _capacity += blocks;
+        _retrim_below = no_limit;
     }
 
-    void* _head{};
-    nstd::vector<void*> _chunks{};
+    // Releases fully free chunks, largest first, as long as at least `headroom` free blocks remain.
+    void _trim(size_t headroom) {
+        // Sorted view of the chunks so each free block can be mapped to its chunk.
+        nstd::vector<chunk*> by_address;
+        by_address.reserve(_chunks.size());
+        for (auto& c : _chunks) {
+            c.scratch = 0;
+            by_address.push_back(&c);
+        }
+        std::sort(by_address.begin(), by_address.end(),
+                  [](const chunk* a, const chunk* b) { return a->begin < b->begin; });
+
+        auto owner{[&](void* block) {
+            auto it{std::upper_bound(
+                by_address.begin(), by_address.end(), static_cast<char*>(block),
+                [](const char* address, const chunk* c) { return address < c->begin; })};
+            return *(it - 1);
+        }};
+
+        // Drain the free list into a private chain, counting free blocks per chunk.
+        void* chain{};
+        while (void* block{_free_list.pop()}) {
+            ++owner(block)->scratch;
+            *static_cast<void**>(block) = chain;
+            chain = block;
+        }
+
+        // A chunk is fully free when every block it ever handed out is back on the free list.
+        nstd::vector<chunk*> candidates;
+        for (auto* c : by_address) {
+            if (c->scratch == c->carved) {
+                candidates.push_back(c);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const chunk* a, const chunk* b) { return a->blocks > b->blocks; });
+
+        size_t free_blocks{_capacity - _live};
+        for (auto* c : candidates) {
+            if (free_blocks - c->blocks < headroom) {
+                continue;
+            }
+            free_blocks -= c->blocks;
+            c->scratch = released;
+        }
+
+        // Put back the blocks of the surviving chunks.
+        while (chain) {
+            void* next{*static_cast<void**>(chain)};
+            if (owner(chain)->scratch != released) {
+                _free_list.push(chain);
+            }
+            chain = next;
+        }
+
+        const size_t old_chunk_count{_chunks.size()};
+        for (size_t i{_chunks.size()}; i > 0; --i) {
+            if (_chunks[i - 1].scratch == released) {
+                _capacity -= _chunks[i - 1].blocks;
+                if constexpr (Instrumentation::enabled) {
+                    _instrumentation.on_chunk_released(_chunks[i - 1].begin);
+                }
+                ChunkSource::deallocate(_chunks[i - 1].begin, _chunks[i - 1].bytes, block_align);
+                _chunks.erase(_chunks.begin() + (i - 1));
+            }
+        }
+
+        _carve_index = 0;
+
+        // If fragmentation kept every chunk alive, wait until the live count halves before the
+        // next attempt so a long run of deallocations does not sweep the free list each time.
+        _retrim_below = _chunks.size() == old_chunk_count ? _live / 2 : no_limit;
+    }
+
+    FreeList _free_list{};
+    nstd::vector<chunk> _chunks{};
+    size_t _carve_index{};
+    size_t _capacity{};
+    size_t _live{};
+    size_t _retrim_below{no_limit};
+    [[no_unique_address]] typename FreeList::mutex_type _expand_mtx{};
+    [[no_unique_address]] Instrumentation _instrumentation{};
+
+    static constexpr size_t released{static_cast<size_t>(-1)};
+    static constexpr size_t no_limit{static_cast<size_t>(-1)};
+
+    // Blocks also hold the embedded next pointer, so they are aligned for it as well.
+    static constexpr size_t block_align{std::max(BlockAlign, alignof(void*))};
+
+    // A multiple of the alignment, so every block in a chunk stays aligned.
+    static constexpr size_t block_size{
+        ((std::max(sizeof(T), sizeof(void*)) + block_align - 1) / block_align) * block_align};
 
-    static constexpr size_t block_size{(std::max(sizeof(T), sizeof(void*)))};
+    // Geometric growth stops at chunks of about 16 MiB.
+    static constexpr size_t max_blocks_per_chunk{
+        std::max(BlocksPerChunk, (size_t{16} << 20) / block_size)};
 };
 } // namespace nstd
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,81 @@
+#ifndef NSTD_POOL_ALLOCATOR_HPP
+#define NSTD_POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include "nstd/concurrent_memory_pool.hpp"
+
+namespace nstd {
+
+// Raw storage for one T. The empty user-provided constructor keeps the pool from value-initialising
+// (zeroing) the block on every allocation.
+template<typename T> struct pool_block {
+    pool_block() {}
+    alignas(T) std::byte bytes[sizeof(T)];
+};
+
+// Stateless Allocator for node based containers.
+//
+// Single-object requests (one node) come from one process-wide pool per type, so the nodes of all
+// containers of the same element type are packed into shared chunks instead of being scattered over
+// the heap. Because every instance compares equal, containers can exchange nodes freely (splice,
+// move, swap). The pool is thread-safe and blocks may be freed on any thread.
+//
+// Array requests fall through to ::operator new.
+//
+// The pool is deliberately never destroyed: containers with static storage duration may still
+// hand their nodes back during program exit.
+template<typename T> class pool_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::true_type;
+
+    template<typename U> struct rebind {
+        using other = pool_allocator<U>;
+    };
+
+    pool_allocator() noexcept = default;
+
+    template<typename U> pool_allocator(const pool_allocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        if (n == 1) {
+            return reinterpret_cast<T*>(_pool().allocate());
+        }
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length{};
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        if (n == 1) {
+            _pool().deallocate(reinterpret_cast<pool_block<T>*>(ptr));
+            return;
+        }
+        ::operator delete(ptr, std::align_val_t{alignof(T)});
+    }
+
+    template<typename U> friend bool operator==(const pool_allocator&, const pool_allocator<U>&) {
+        return true;
+    }
+
+private:
+    static concurrent_memory_pool<pool_block<T>, 1024, 256>& _pool() {
+        static auto* pool{new concurrent_memory_pool<pool_block<T>, 1024, 256>{}};
+        return *pool;
+    }
+};
+
+} // namespace nstd
+
+#endif // NSTD_POOL_ALLOCATOR_HPP
@@ -0,0 +1,605 @@
+#ifndef NSTD_ROPE_HPP
+#define NSTD_ROPE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+
+namespace nstd {
+
+// Text stored as a height-balanced (AVL) binary tree whose leaves are immutable chunks of at most
+// leaf_capacity characters.
+//
+// Nodes are never modified after construction, only shared: copying a rope is O(1), and every
+// edit copies just the O(log n) nodes on the path it touches, so earlier copies (snapshots) stay
+// intact and unchanged subtrees are shared between them. Reference counts are atomic, so ropes
+// sharing nodes can be used from different threads.
+//
+// insert / erase / substr / concatenation are O(log n) plus at most a few leaf copies; indexing is
+// O(log n); iteration walks the leaves as contiguous string_views (see chunks()).
+class rope {
+    struct node {
+        std::atomic<size_t> refs{1};
+        size_t size{};
+        unsigned height{};
+        node* left{};
+        node* right{};
+
+        bool is_leaf() const noexcept {
+            return height == 0;
+        }
+
+        // Leaf characters follow the node in the same allocation.
+        const char* chars() const noexcept {
+            return reinterpret_cast<const char*>(this + 1);
+        }
+    };
+
+    // Owning reference to a node (nullptr is the empty rope).
+    class node_ref {
+    public:
+        node_ref() noexcept = default;
+        explicit node_ref(node* adopted) noexcept : _node{adopted} {}
+
+        node_ref(const node_ref& other) noexcept : _node{other._node} {
+            _retain(_node);
+        }
+
+        node_ref(node_ref&& other) noexcept : _node{std::exchange(other._node, nullptr)} {}
+
+        node_ref& operator=(node_ref other) noexcept {
+            std::swap(_node, other._node);
+            return *this;
+        }
+
+        ~node_ref() {
+            _release(_node);
+        }
+
+        node* get() const noexcept {
+            return _node;
+        }
+
+        node* operator->() const noexcept {
+            return _node;
+        }
+
+        explicit operator bool() const noexcept {
+            return _node != nullptr;
+        }
+
+        // Gives up ownership without touching the count.
+        node* release() noexcept {
+            return std::exchange(_node, nullptr);
+        }
+
+        static node_ref share(node* shared) noexcept {
+            _retain(shared);
+            return node_ref{shared};
+        }
+
+    private:
+        static void _retain(node* target) noexcept {
+            if (target) {
+                target->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        static void _release(node* target) noexcept {
+            if (target && target->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                _release(target->left);
+                _release(target->right);
+                target->~node();
+                ::operator delete(target);
+            }
+        }
+
+        node* _node{};
+    };
+
+public:
+    static constexpr size_t leaf_capacity{1024};
+    static constexpr size_t npos{string_view::npos};
+
+    class chunk_iterator;
+    class const_iterator;
+
+    // Range over the leaves, in order, as contiguous views.
+    class chunk_range {
+    public:
+        chunk_iterator begin() const noexcept;
+        chunk_iterator end() const noexcept;
+
+    private:
+        friend class rope;
+        explicit chunk_range(const node* root) noexcept : _root{root} {}
+
+        const node* _root;
+    };
+
+    rope() noexcept = default;
+
+    explicit rope(string_view text) : _root{_build(text.data(), text.size())} {}
+
+    size_t size() const noexcept {
+        return _root ? _root->size : 0;
+    }
+
+    size_t length() const noexcept {
+        return size();
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    // Height of the tree: 0 for a single leaf.
+    size_t height() const noexcept {
+        return _root ? _root->height : 0;
+    }
+
+    char operator[](size_t pos) const noexcept {
+        assert(pos < size());
+        const auto [leaf, offset]{_locate(_root.get(), pos)};
+        return leaf->chars()[offset];
+    }
+
+    char at(size_t pos) const {
+        if (pos >= size()) {
+            throw std::out_of_range("rope::at: index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    void insert(size_t pos, string_view text) {
+        if (pos > size()) {
+            throw std::out_of_range("rope::insert: position out of range");
+        }
+        if (text.empty()) {
+            return;
+        }
+        _root = _root ? _insert(_root.get(), pos, text) : _build(text.data(), text.size());
+    }
+
+    void insert(size_t pos, const rope& other) {
+        if (pos > size()) {
+            throw std::out_of_range("rope::insert: position out of range");
+        }
+        auto [left, right]{_split(_root.get(), pos)};
+        _root = _join(_join(left, other._root), right);
+    }
+
+    // Removes [pos, pos + count), clamped to the end of the rope.
+    void erase(size_t pos, size_t count = npos) {
+        if (pos > size()) {
+            throw std::out_of_range("rope::erase: position out of range");
+        }
+        count = std::min(count, size() - pos);
+        if (count > 0) {
+            _root = _erase(_root.get(), pos, count);
+        }
+    }
+
+    void append(string_view text) {
+        insert(size(), text);
+    }
+
+    void append(const rope& other) {
+        _root = _join(_root, other._root);
+    }
+
+    rope& operator+=(string_view text) {
+        append(text);
+        return *this;
+    }
+
+    rope& operator+=(const rope& other) {
+        append(other);
+        return *this;
+    }
+
+    friend rope operator+(const rope& first, const rope& second) {
+        rope result{first};
+        result.append(second);
+        return result;
+    }
+
+    // The characters [pos, pos + count), clamped to the end of the rope, sharing all whole leaves.
+    rope substr(size_t pos, size_t count = npos) const {
+        if (pos > size()) {
+            throw std::out_of_range("rope::substr: position out of range");
+        }
+        count = std::min(count, size() - pos);
+
+        rope result;
+        auto [before, rest]{_split(_root.get(), pos)};
+        result._root = std::move(_split(rest.get(), count).first);
+        return result;
+    }
+
+    void clear() noexcept {
+        _root = node_ref{};
+    }
+
+    // Flattens the rope into one contiguous string.
+    string str() const;
+
+    chunk_range chunks() const noexcept {
+        return chunk_range{_root.get()};
+    }
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    friend bool operator==(const rope& first, const rope& second) noexcept;
+    friend bool operator==(const rope& first, string_view second) noexcept;
+
+private:
+    static unsigned _height(const node* target) noexcept {
+        return target ? target->height : 0;
+    }
+
+    static node_ref _leaf(const char* first, size_t count, const char* second = nullptr,
+                          size_t second_count = 0, const char* third = nullptr,
+                          size_t third_count = 0) {
+        const auto total{count + second_count + third_count};
+        assert(total > 0 && total <= leaf_capacity);
+
+        auto* memory{::operator new(sizeof(node) + total)};
+        auto* leaf{new (memory) node{}};
+        leaf->size = total;
+
+        auto* chars{reinterpret_cast<char*>(leaf + 1)};
+        std::memcpy(chars, first, count);
+        if (second_count) {
+            std::memcpy(chars + count, second, second_count);
+        }
+        if (third_count) {
+            std::memcpy(chars + count + second_count, third, third_count);
+        }
+        return node_ref{leaf};
+    }
+
+    static node_ref _branch(node_ref left, node_ref right) {
+        assert(left && right);
+        auto* branch{new (::operator new(sizeof(node))) node{}};
+        branch->size = left->size + right->size;
+        branch->height = std::max(left->height, right->height) + 1;
+        branch->left = left.release();
+        branch->right = right.release();
+        return node_ref{branch};
+    }
+
+    // Balanced tree over `count` characters, with leaves between leaf_capacity / 2 and
+    // leaf_capacity characters.
+    static node_ref _build(const char* chars, size_t count) {
+        if (count == 0) {
+            return {};
+        }
+        if (count <= leaf_capacity) {
+            return _leaf(chars, count);
+        }
+        const auto half{count / 2};
+        return _branch(_build(chars, half), _build(chars + half, count - half));
+    }
+
+    static void _copy_to(const node* target, char* out) noexcept {
+        if (target->is_leaf()) {
+            std::memcpy(out, target->chars(), target->size);
+            return;
+        }
+        _copy_to(target->left, out);
+        _copy_to(target->right, out + target->left->size);
+    }
+
+    static node_ref _flatten(const node* left, const node* right) {
+        char buffer[leaf_capacity];
+        _copy_to(left, buffer);
+        _copy_to(right, buffer + left->size);
+        return _leaf(buffer, left->size + right->size);
+    }
+
+    // Concatenation of two balanced trees of any heights, rebalancing along the spine of the
+    // taller one. Joins whose result fits in one leaf are flattened, which keeps edits from
+    // leaving runs of tiny leaves behind.
+    static node_ref _join(const node_ref& left, const node_ref& right) {
+        if (!left) {
+            return right;
+        }
+        if (!right) {
+            return left;
+        }
+        if (left->size + right->size <= leaf_capacity) {
+            return _flatten(left.get(), right.get());
+        }
+
+        const auto left_height{left->height};
+        const auto right_height{right->height};
+        if (left_height > right_height + 1) {
+            return _balance(node_ref::share(left->left),
+                            _join(node_ref::share(left->right), right));
+        }
+        if (right_height > left_height + 1) {
+            return _balance(_join(left, node_ref::share(right->left)),
+                            node_ref::share(right->right));
+        }
+        return _branch(left, right);
+    }
+
+    // Joins two trees that are usually within two levels of each other, with one AVL rotation.
+    static node_ref _balance(node_ref left, node_ref right) {
+        const auto left_height{_height(left.get())};
+        const auto right_height{_height(right.get())};
+
+        if (!left || !right || left_height + 2 < right_height || right_height + 2 < left_height) {
+            return _join(left, right);
+        }
+        if (right_height == left_height + 2) {
+            auto* r{right.get()};
+            if (_height(r->left) > _height(r->right)) {
+                return _branch(_branch(std::move(left), node_ref::share(r->left->left)),
+                               _branch(node_ref::share(r->left->right),
+                                       node_ref::share(r->right)));
+            }
+            return _branch(_branch(std::move(left), node_ref::share(r->left)),
+                           node_ref::share(r->right));
+        }
+        if (left_height == right_height + 2) {
+            auto* l{left.get()};
+            if (_height(l->right) > _height(l->left)) {
+                return _branch(_branch(node_ref::share(l->left), node_ref::share(l->right->left)),
+                               _branch(node_ref::share(l->right->right), std::move(right)));
+            }
+            return _branch(node_ref::share(l->left),
+                           _branch(node_ref::share(l->right), std::move(right)));
+        }
+        return _branch(std::move(left), std::move(right));
+    }
+
+    // The trees of the first `pos` characters and of the rest.
+    static std::pair<node_ref, node_ref> _split(node* target, size_t pos) {
+        if (!target) {
+            return {};
+        }
+        if (pos == 0) {
+            return {node_ref{}, node_ref::share(target)};
+        }
+        if (pos >= target->size) {
+            return {node_ref::share(target), node_ref{}};
+        }
+        if (target->is_leaf()) {
+            return {_leaf(target->chars(), pos),
+                    _leaf(target->chars() + pos, target->size - pos)};
+        }
+
+        const auto left_size{target->left->size};
+        if (pos <= left_size) {
+            auto [first, second]{_split(target->left, pos)};
+            return {std::move(first), _join(second, node_ref::share(target->right))};
+        }
+        auto [first, second]{_split(target->right, pos - left_size)};
+        return {_join(node_ref::share(target->left), first), std::move(second)};
+    }
+
+    // Copies the path down to the leaf holding `pos` and inserts into that leaf, splitting it when
+    // it overflows.
+    static node_ref _insert(node* target, size_t pos, string_view text) {
+        if (target->is_leaf()) {
+            const auto* chars{target->chars()};
+            const auto rest{target->size - pos};
+            if (target->size + text.size() <= leaf_capacity) {
+                return _leaf(chars, pos, text.data(), text.size(), chars + pos, rest);
+            }
+            auto middle{_build(text.data(), text.size())};
+            auto before{pos ? _leaf(chars, pos) : node_ref{}};
+            auto after{rest ? _leaf(chars + pos, rest) : node_ref{}};
+            return _join(_join(before, middle), after);
+        }
+
+        const auto left_size{target->left->size};
+        if (pos <= left_size) {
+            return _balance(_insert(target->left, pos, text), node_ref::share(target->right));
+        }
+        return _balance(node_ref::share(target->left),
+                        _insert(target->right, pos - left_size, text));
+    }
+
+    static node_ref _erase(node* target, size_t pos, size_t count) {
+        if (pos == 0 && count == target->size) {
+            return {};
+        }
+        if (target->is_leaf()) {
+            const auto* chars{target->chars()};
+            return _leaf(chars, pos, chars + pos + count, target->size - pos - count);
+        }
+
+        const auto left_size{target->left->size};
+        auto left{node_ref::share(target->left)};
+        auto right{node_ref::share(target->right)};
+        if (pos < left_size) {
+            left = _erase(target->left, pos, std::min(count, left_size - pos));
+        }
+        if (pos + count > left_size) {
+            const auto from{std::max(pos, left_size)};
+            right = _erase(target->right, from - left_size, pos + count - from);
+        }
+        return _join(left, right);
+    }
+
+    // The leaf holding character `pos`, and the offset of that character in it.
+    static std::pair<const node*, size_t> _locate(const node* target, size_t pos) noexcept {
+        while (!target->is_leaf()) {
+            if (pos < target->left->size) {
+                target = target->left;
+            } else {
+                pos -= target->left->size;
+                target = target->right;
+            }
+        }
+        return {target, pos};
+    }
+
+    node_ref _root{};
+};
+
+// Forward iterator over the leaves. Moving to the next leaf descends from the root again, which
+// costs O(log n) per leaf, i.e. a small constant per character.
+class rope::chunk_iterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const string_view*;
+    using reference = const string_view&;
+
+    chunk_iterator() = default;
+
+    reference operator*() const noexcept {
+        return _chunk;
+    }
+
+    pointer operator->() const noexcept {
+        return &_chunk;
+    }
+
+    chunk_iterator& operator++() noexcept {
+        _offset += _chunk.size();
+        _load();
+        return *this;
+    }
+
+    chunk_iterator operator++(int) noexcept {
+        auto temp{*this};
+        ++(*this);
+        return temp;
+    }
+
+    // Position of the first character of the current chunk.
+    size_t offset() const noexcept {
+        return _offset;
+    }
+
+    friend bool operator==(const chunk_iterator& first, const chunk_iterator& second) noexcept {
+        return first._offset == second._offset;
+    }
+
+private:
+    friend class rope;
+
+    chunk_iterator(const node* root, size_t offset) noexcept : _root{root}, _offset{offset} {
+        _load();
+    }
+
+    void _load() noexcept {
+        if (!_root || _offset >= _root->size) {
+            _chunk = {};
+            return;
+        }
+        const auto [leaf, index]{_locate(_root, _offset)};
+        _chunk = {leaf->chars() + index, leaf->size - index};
+    }
+
+    const node* _root{};
+    size_t _offset{};
+    string_view _chunk{};
+};
+
+// Forward iterator over the characters.
+class rope::const_iterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = char;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const char*;
+    using reference = const char&;
+
+    const_iterator() = default;
+
+    reference operator*() const noexcept {
+        return (*_chunk)[_index];
+    }
+
+    const_iterator& operator++() noexcept {
+        if (++_index == _chunk->size()) {
+            ++_chunk;
+            _index = 0;
+        }
+        return *this;
+    }
+
+    const_iterator operator++(int) noexcept {
+        auto temp{*this};
+        ++(*this);
+        return temp;
+    }
+
+    friend bool operator==(const const_iterator& first, const const_iterator& second) noexcept {
+        return first._chunk == second._chunk && first._index == second._index;
+    }
+
+private:
+    friend class rope;
+
+    explicit const_iterator(chunk_iterator chunk) noexcept : _chunk{chunk} {}
+
+    chunk_iterator _chunk{};
+    size_t _index{};
+};
+
+inline rope::chunk_iterator rope::chunk_range::begin() const noexcept {
+    return chunk_iterator{_root, 0};
+}
+
+inline rope::chunk_iterator rope::chunk_range::end() const noexcept {
+    return chunk_iterator{_root, _root ? _root->size : 0};
+}
+
+inline rope::const_iterator rope::begin() const noexcept {
+    return const_iterator{chunks().begin()};
+}
+
+inline rope::const_iterator rope::end() const noexcept {
+    return const_iterator{chunks().end()};
+}
+
+inline string rope::str() const {
+    string result;
+    result.reserve(size());
+    for (auto chunk : chunks()) {
+        result.append(chunk);
+    }
+    return result;
+}
+
+inline bool operator==(const rope& first, const rope& second) noexcept {
+    if (first.size() != second.size()) {
+        return false;
+    }
+    return std::equal(first.begin(), first.end(), second.begin());
+}
+
+inline bool operator==(const rope& first, string_view second) noexcept {
+    if (first.size() != second.size()) {
+        return false;
+    }
+    for (auto chunk : first.chunks()) {
+        if (chunk != second.substr(0, chunk.size())) {
+            return false;
+        }
+        second.remove_prefix(chunk.size());
+    }
+    return true;
+}
+
+} // namespace nstd
+
+#endif // NSTD_ROPE_HPP
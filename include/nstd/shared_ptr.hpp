@@ -1,7 +1,11 @@
 #ifndef NSTD_SHARED_PTR_HPP
 #define NSTD_SHARED_PTR_HPP
 
+#include <atomic>
 #include <cstddef>
+#include <utility>
+
+#include "nstd/type_traits.hpp"
 
 namespace nstd {
 
@@ -65,7 +69,7 @@ public:
         return *_ptr;
     }
     constexpr size_t use_count() const noexcept {
-        return _ref_count ? *_ref_count : 0;
+        return _ref_count ? _ref_count->load() : 0;
     }
 
 private:
@@ -90,6 +94,9 @@ private:
 template<typename T, typename... Args> constexpr shared_ptr<T> make_shared(Args&&... args) {
     return shared_ptr<T>{new T(std::forward<Args>(args)...)};
 }
+
+// The reference count lives on the heap, so a relocated shared_ptr needs no count update.
+template<typename T> struct is_trivially_relocatable<shared_ptr<T>> : std::true_type {};
 }; // namespace nstd
 
 #endif
\ No newline at end of file
@@ -0,0 +1,158 @@
+#ifndef NSTD_SLAB_ALLOCATOR_HPP
+#define NSTD_SLAB_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "nstd/memory_pool.hpp"
+
+namespace nstd {
+
+// Raw storage for one slab block. The empty user-provided constructor keeps memory_pool from
+// value-initialising (zeroing) the block on every allocation.
+template<size_t Size> struct slab_block {
+    slab_block() {}
+    std::byte bytes[Size];
+};
+
+// General purpose size-class allocator.
+//
+// Requests are rounded up to the next power of two between min_block_size and max_block_size and
+// served from one memory_pool per size class. Larger or over-aligned requests fall through to
+// ::operator new. Like memory_pool it is single-threaded.
+//
+// Blocks are only guaranteed to be aligned to __STDCPP_DEFAULT_NEW_ALIGNMENT__. The alignment is
+// part of both calls: deallocate() must get the same bytes and align that allocate() did, because
+// it decides from them alone whether the block came from a pool or from aligned ::operator new.
+class slab_resource {
+public:
+    static constexpr size_t min_block_size{16};
+    static constexpr size_t max_block_size{4096};
+    static constexpr size_t class_count{std::bit_width(max_block_size / min_block_size)};
+
+    slab_resource() = default;
+
+    slab_resource(const slab_resource&) = delete;
+    slab_resource& operator=(const slab_resource&) = delete;
+
+    void* allocate(size_t bytes, size_t align) {
+        if (_is_large(bytes, align)) {
+            return ::operator new(bytes, std::align_val_t{align});
+        }
+
+        return _dispatch(_class_index(bytes), [](auto& pool) -> void* { return pool.allocate(); });
+    }
+
+    void deallocate(void* ptr, size_t bytes, size_t align) noexcept {
+        if (!ptr) {
+            return;
+        }
+
+        if (_is_large(bytes, align)) {
+            ::operator delete(ptr, std::align_val_t{align});
+            return;
+        }
+
+        _dispatch(_class_index(bytes), [ptr](auto& pool) -> void* {
+            using block_type = std::remove_pointer_t<decltype(pool.allocate())>;
+            pool.deallocate(static_cast<block_type*>(ptr));
+            return nullptr;
+        });
+    }
+
+    // Size actually reserved for a request of the given size.
+    static constexpr size_t block_size_for(size_t bytes) noexcept {
+        return bytes > max_block_size ? bytes : min_block_size << _class_index(bytes);
+    }
+
+private:
+    static constexpr size_t _class_index(size_t bytes) noexcept {
+        if (bytes <= min_block_size) {
+            return 0;
+        }
+        return std::bit_width(bytes - 1) - std::bit_width(min_block_size - 1);
+    }
+
+    static constexpr bool _is_large(size_t bytes, size_t align) noexcept {
+        return bytes > max_block_size || align > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    }
+
+    // Roughly 16 KiB chunks for every class, but never fewer than 4 blocks per chunk.
+    template<size_t I> static constexpr size_t _block_size{min_block_size << I};
+    template<size_t I>
+    static constexpr size_t _blocks_per_chunk{std::max<size_t>(16384 / _block_size<I>, 4)};
+    // slab_block is a byte array, so the default-new alignment has to be asked for explicitly.
+    template<size_t I>
+    using _pool = memory_pool<slab_block<_block_size<I>>, _blocks_per_chunk<I>, intrusive_free_list,
+                              __STDCPP_DEFAULT_NEW_ALIGNMENT__>;
+
+    template<typename Seq> struct _pools_for;
+    template<size_t... I> struct _pools_for<std::index_sequence<I...>> {
+        using type = std::tuple<_pool<I>...>;
+    };
+
+    template<typename F> void* _dispatch(size_t index, F&& f) {
+        return [&]<size_t... I>(std::index_sequence<I...>) {
+            void* result{};
+            ((index == I ? (result = f(std::get<I>(_pools)), true) : false) || ...);
+            return result;
+        }(std::make_index_sequence<class_count>{});
+    }
+
+    typename _pools_for<std::make_index_sequence<class_count>>::type _pools{};
+};
+
+// Standard Allocator over a slab_resource. The resource must outlive every allocator copy.
+template<typename T> class slab_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template<typename U> struct rebind {
+        using other = slab_allocator<U>;
+    };
+
+    explicit slab_allocator(slab_resource& resource) noexcept : _resource{&resource} {}
+
+    template<typename U>
+    slab_allocator(const slab_allocator<U>& other) noexcept : _resource{other.resource()} {}
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length{};
+        }
+        return static_cast<T*>(_resource->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        _resource->deallocate(ptr, n * sizeof(T), alignof(T));
+    }
+
+    slab_resource* resource() const noexcept {
+        return _resource;
+    }
+
+    template<typename U>
+    friend bool operator==(const slab_allocator& a, const slab_allocator<U>& b) {
+        return a.resource() == b.resource();
+    }
+
+private:
+    slab_resource* _resource{};
+};
+
+} // namespace nstd
+
+#endif // NSTD_SLAB_ALLOCATOR_HPP
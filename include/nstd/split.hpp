@@ -0,0 +1,260 @@
+#ifndef NSTD_SPLIT_HPP
+#define NSTD_SPLIT_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+
+namespace nstd {
+
+// Lazy range over the fields of a text separated by a delimiter, which is either a single
+// character or a (non-empty) string. Fields are views into the text: nothing is copied or
+// allocated, and each step is one string_view::find(), which runs on the vectorized search
+// kernels for `char`.
+//
+// n delimiters give n + 1 fields, empty ones included, so "a,,b" yields "a", "" and "b", and an
+// empty text yields one empty field. Iterators do not refer to the range object, only to the
+// text, which must outlive them.
+template<typename CharT, typename Delimiter>
+class split_view : public std::ranges::view_interface<split_view<CharT, Delimiter>> {
+public:
+    using view_type = basic_string_view<CharT>;
+
+    class iterator;
+
+    constexpr split_view() noexcept = default;
+
+    constexpr split_view(view_type text, Delimiter delimiter) noexcept
+        : _text{text}, _delimiter{delimiter} {
+        if constexpr (!std::is_same_v<Delimiter, CharT>) {
+            assert(!delimiter.empty());
+        }
+    }
+
+    constexpr iterator begin() const noexcept {
+        return iterator{_text, _delimiter};
+    }
+
+    constexpr iterator end() const noexcept {
+        return iterator{};
+    }
+
+private:
+    view_type _text{};
+    Delimiter _delimiter{};
+};
+
+template<typename CharT, typename Delimiter> class split_view<CharT, Delimiter>::iterator {
+public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = view_type;
+    using difference_type = std::ptrdiff_t;
+
+    // The end iterator.
+    constexpr iterator() noexcept = default;
+
+    constexpr value_type operator*() const noexcept {
+        return _field;
+    }
+
+    constexpr iterator& operator++() noexcept {
+        if (_last) {
+            *this = iterator{};
+        } else {
+            _advance(_rest);
+        }
+        return *this;
+    }
+
+    constexpr iterator operator++(int) noexcept {
+        auto temp{*this};
+        ++(*this);
+        return temp;
+    }
+
+    // Fields start at distinct positions, so the start identifies the field.
+    friend constexpr bool operator==(const iterator& first, const iterator& second) noexcept {
+        return first._done == second._done &&
+               (first._done || first._field.data() == second._field.data());
+    }
+
+private:
+    friend class split_view;
+
+    constexpr iterator(view_type text, Delimiter delimiter) noexcept
+        : _delimiter{delimiter}, _done{false} {
+        _advance(text);
+    }
+
+    constexpr void _advance(view_type text) noexcept {
+        const auto pos{text.find(_delimiter)};
+        if (pos == view_type::npos) {
+            _field = text;
+            _rest = {};
+            _last = true;
+            return;
+        }
+
+        size_t delimiter_size{1};
+        if constexpr (!std::is_same_v<Delimiter, CharT>) {
+            delimiter_size = _delimiter.size();
+        }
+        _field = {text.data(), pos};
+        _rest = {text.data() + pos + delimiter_size, text.size() - pos - delimiter_size};
+    }
+
+    view_type _field{};
+    view_type _rest{};
+    Delimiter _delimiter{};
+    bool _last{};
+    bool _done{true};
+};
+
+// Lazy range over the tokens of a text: the maximal non-empty runs of characters that are not in
+// `separators`. Runs of separators, leading and trailing ones included, produce no tokens, so
+// tokenizing "  a \t b " on " \t" yields "a" and "b". Each step is a find_first_not_of() /
+// find_first_of() pair, which for `char` and up to eight separators runs on the vector kernels.
+template<typename CharT>
+class tokenize_view : public std::ranges::view_interface<tokenize_view<CharT>> {
+public:
+    using view_type = basic_string_view<CharT>;
+
+    class iterator;
+
+    constexpr tokenize_view() noexcept = default;
+
+    constexpr tokenize_view(view_type text, view_type separators) noexcept
+        : _text{text}, _separators{separators} {}
+
+    constexpr iterator begin() const noexcept {
+        return iterator{_text, _separators};
+    }
+
+    constexpr iterator end() const noexcept {
+        return iterator{};
+    }
+
+private:
+    view_type _text{};
+    view_type _separators{};
+};
+
+template<typename CharT> class tokenize_view<CharT>::iterator {
+public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = view_type;
+    using difference_type = std::ptrdiff_t;
+
+    // The end iterator.
+    constexpr iterator() noexcept = default;
+
+    constexpr value_type operator*() const noexcept {
+        return _token;
+    }
+
+    constexpr iterator& operator++() noexcept {
+        _advance(_rest);
+        return *this;
+    }
+
+    constexpr iterator operator++(int) noexcept {
+        auto temp{*this};
+        ++(*this);
+        return temp;
+    }
+
+    friend constexpr bool operator==(const iterator& first, const iterator& second) noexcept {
+        return first._token.data() == second._token.data();
+    }
+
+private:
+    friend class tokenize_view;
+
+    constexpr iterator(view_type text, view_type separators) noexcept : _separators{separators} {
+        _advance(text);
+    }
+
+    // Tokens are never empty, so a null data pointer marks the end.
+    constexpr void _advance(view_type text) noexcept {
+        const auto start{text.find_first_not_of(_separators)};
+        if (start == view_type::npos) {
+            *this = iterator{};
+            return;
+        }
+
+        auto stop{text.find_first_of(_separators, start)};
+        if (stop == view_type::npos) {
+            stop = text.size();
+        }
+        _token = {text.data() + start, stop - start};
+        _rest = {text.data() + stop, text.size() - stop};
+    }
+
+    view_type _token{};
+    view_type _rest{};
+    view_type _separators{};
+};
+
+template<typename CharT>
+constexpr split_view<CharT, CharT> split(basic_string_view<CharT> text, CharT delimiter) noexcept {
+    return {text, delimiter};
+}
+
+template<typename CharT>
+constexpr split_view<CharT, basic_string_view<CharT>>
+split(basic_string_view<CharT> text,
+      std::type_identity_t<basic_string_view<CharT>> delimiter) noexcept {
+    return {text, delimiter};
+}
+
+template<typename CharT, typename Allocator>
+split_view<CharT, CharT> split(const basic_string<CharT, Allocator>& text,
+                               CharT delimiter) noexcept {
+    return {text, delimiter};
+}
+
+template<typename CharT, typename Allocator>
+split_view<CharT, basic_string_view<CharT>>
+split(const basic_string<CharT, Allocator>& text,
+      std::type_identity_t<basic_string_view<CharT>> delimiter) noexcept {
+    return {text, delimiter};
+}
+
+// The fields would point into a temporary.
+template<typename CharT, typename Allocator, typename Delimiter>
+void split(const basic_string<CharT, Allocator>&& text, Delimiter delimiter) = delete;
+
+template<typename CharT>
+constexpr tokenize_view<CharT>
+tokenize(basic_string_view<CharT> text,
+         std::type_identity_t<basic_string_view<CharT>> separators) noexcept {
+    return {text, separators};
+}
+
+template<typename CharT, typename Allocator>
+tokenize_view<CharT> tokenize(const basic_string<CharT, Allocator>& text,
+                              std::type_identity_t<basic_string_view<CharT>> separators) noexcept {
+    return {text, separators};
+}
+
+template<typename CharT, typename Allocator, typename Separators>
+void tokenize(const basic_string<CharT, Allocator>&& text, Separators separators) = delete;
+
+} // namespace nstd
+
+// Iterators point into the text, not into the range object, so they may outlive it.
+template<typename CharT, typename Delimiter>
+inline constexpr bool std::ranges::enable_borrowed_range<nstd::split_view<CharT, Delimiter>> =
+    true;
+
+template<typename CharT>
+inline constexpr bool std::ranges::enable_borrowed_range<nstd::tokenize_view<CharT>> = true;
+
+#endif // NSTD_SPLIT_HPP
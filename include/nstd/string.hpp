@@ -2,8 +2,11 @@
 #define NSTD_STRING_HPP
 
 #include <algorithm>
+#include <bit>
 #include <cassert>
+#include <compare>
 #include <cstddef>
+#include <cstring>
 #include <iosfwd>
 #include <iterator>
 #include <limits>
@@ -11,21 +14,52 @@
 #include <stdexcept>
 #include <string>
 
+#include "nstd/string_view.hpp"
+#include "nstd/type_traits.hpp"
+
 namespace nstd {
-template<typename CharT> class basic_string {
+
+// Strings of up to inline_capacity characters live inside the object itself (small string
+// optimization): 22 chars for nstd::string on 64-bit targets, in a 24-byte object. Default
+// construction, moves and swaps never allocate.
+template<typename CharT, typename Allocator = std::allocator<CharT>> class basic_string {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    struct heap_rep {
+        size_t capacity;
+        size_t size;
+        CharT* data;
+    };
+
 public:
-    basic_string();
-    template<size_t N> basic_string(const CharT (&str)[N]);
-    basic_string(const CharT* str);
+    // Characters that fit without allocating (not counting the terminating null).
+    static constexpr size_t inline_capacity{
+        (sizeof(heap_rep) - alignof(CharT)) / sizeof(CharT) - 1};
+
+    using allocator_type = Allocator;
+    using view_type = basic_string_view<CharT>;
+
+    static constexpr size_t npos{view_type::npos};
+
+    basic_string() noexcept;
+    explicit basic_string(const Allocator& alloc) noexcept;
+    template<size_t N> basic_string(const CharT (&str)[N], const Allocator& alloc = Allocator());
+    basic_string(const CharT* str, const Allocator& alloc = Allocator());
     basic_string(const basic_string& other);
     basic_string(basic_string&& other) noexcept;
-    basic_string(size_t count, CharT c);
-    basic_string& operator=(basic_string other);
+    basic_string(size_t count, CharT c, const Allocator& alloc = Allocator());
+    explicit basic_string(view_type view, const Allocator& alloc = Allocator());
+    basic_string& operator=(const basic_string& other);
+    basic_string& operator=(basic_string&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_traits::is_always_equal::value);
     basic_string& operator=(const CharT* str);
     size_t size() const noexcept;
     size_t length() const noexcept;
+    size_t max_size() const noexcept;
     const CharT* data() const noexcept;
     const CharT* c_str() const noexcept;
+    operator view_type() const noexcept;
     CharT& operator[](size_t pos);
     const CharT& operator[](size_t pos) const;
     CharT& at(size_t pos);
@@ -34,18 +68,38 @@ public:
     void push_back(CharT ch);
     void pop_back();
     basic_string& append(const CharT* str);
+    basic_string& append(const CharT* str, size_t count);
+    basic_string& append(const basic_string& other);
+    basic_string& append(view_type view);
     basic_string& operator+=(CharT ch);
     basic_string& operator+=(const CharT* str);
     basic_string& operator+=(const basic_string& other);
+    basic_string& operator+=(view_type view);
+    int compare(view_type other) const noexcept;
+    size_t find(view_type needle, size_t pos = 0) const noexcept;
+    size_t find(CharT ch, size_t pos = 0) const noexcept;
+    size_t rfind(view_type needle, size_t pos = npos) const noexcept;
+    size_t rfind(CharT ch, size_t pos = npos) const noexcept;
+    size_t find_first_of(view_type set, size_t pos = 0) const noexcept;
+    size_t find_last_of(view_type set, size_t pos = npos) const noexcept;
+    size_t find_first_not_of(view_type set, size_t pos = 0) const noexcept;
+    size_t find_last_not_of(view_type set, size_t pos = npos) const noexcept;
     void clear();
     size_t capacity() const noexcept;
     void reserve(size_t new_cap);
+    template<typename Operation> void resize_and_overwrite(size_t count, Operation op);
+    allocator_type get_allocator() const noexcept;
     ~basic_string();
 
+    // Allocators are only exchanged when they propagate on swap, otherwise they must compare equal.
     friend void swap(basic_string& lhs, basic_string& rhs) noexcept {
-        std::swap(lhs._data, rhs._data);
-        std::swap(lhs._length, rhs._length);
-        std::swap(lhs._capacity, rhs._capacity);
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+            std::swap(lhs._alloc, rhs._alloc);
+        } else {
+            assert(lhs._alloc == rhs._alloc);
+        }
+        // Both layouts are trivially copyable, inline characters included.
+        std::swap(lhs._rep, rhs._rep);
     }
 
     CharT* begin() noexcept;
@@ -56,32 +110,68 @@ public:
     const CharT* cend() const noexcept;
 
     friend std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os,
-                                                 const basic_string<CharT>& str) {
+                                                 const basic_string& str) {
         return os << str.c_str();
     }
 
-    friend bool operator==(const basic_string& first, const basic_string& second) {
-        if (first._length != second._length) {
-            return false;
-        }
-        return std::equal(first.begin(), first.end(), second.begin());
+    friend bool operator==(const basic_string& first, const basic_string& second) noexcept {
+        return view_type{first} == view_type{second};
+    }
+
+    friend std::strong_ordering operator<=>(const basic_string& first,
+                                            const basic_string& second) noexcept {
+        return view_type{first} <=> view_type{second};
     }
 
 private:
-    size_t _capacity{};
-    size_t _length{};
-    CharT* _data{};
+    struct inline_rep {
+        unsigned char tag;
+        CharT data[inline_capacity + 1];
+    };
+
+    static_assert(sizeof(inline_rep) <= sizeof(heap_rep));
+
+    // The first byte of the object tells the layouts apart. For an inline string it is the tag
+    // holding the size; for a heap string it is the byte of heap_rep::capacity that overlaps the
+    // tag, and heap capacities are encoded so that this byte always has tag_flag set.
+    static constexpr bool little_endian{std::endian::native == std::endian::little};
+    static constexpr unsigned char tag_flag{little_endian ? 0x01 : 0x80};
+    static constexpr size_t capacity_flag{
+        little_endian ? size_t{1} : size_t{1} << (std::numeric_limits<size_t>::digits - 1)};
+
+    bool _is_inline() const noexcept;
+    CharT* _ptr() noexcept;
+    const CharT* _ptr() const noexcept;
+    void _set_size(size_t size) noexcept;
+    void _set_inline_size(size_t size) noexcept;
+    void _set_heap(CharT* data, size_t size, size_t capacity) noexcept;
+    void _init(const CharT* str, size_t len);
+    void _assign(const CharT* str, size_t len);
+    void _release() noexcept;
+    size_t _grown_capacity(size_t required) const noexcept;
+    CharT* _allocate(size_t count);
+    void _deallocate(CharT* ptr, size_t count) noexcept;
+
+    // Zero-initialized storage is the empty inline string.
+    union {
+        heap_rep heap;
+        inline_rep local;
+    } _rep{};
+    [[no_unique_address]] Allocator _alloc{};
 };
 
 // Definitions
 
-template<typename CharT>
-basic_string<CharT>::basic_string()
-    : _capacity{1}, _length{}, _data{new CharT[_capacity]{CharT{}}} {}
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>::basic_string() noexcept : basic_string(Allocator()) {}
+
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>::basic_string(const Allocator& alloc) noexcept : _alloc{alloc} {}
 
-template<typename CharT>
+template<typename CharT, typename Allocator>
 template<size_t N>
-basic_string<CharT>::basic_string(const CharT (&str)[N]) {
+basic_string<CharT, Allocator>::basic_string(const CharT (&str)[N], const Allocator& alloc)
+    : _alloc{alloc} {
     static_assert(N > 0, "Array size must be greater than 0");
 
     size_t len = N;
@@ -90,22 +180,12 @@ basic_string<CharT>::basic_string(const CharT (&str)[N]) {
         len = N - 1;
     }
 
-    auto* temp{new CharT[len + 1]};
-
-    try {
-        std::copy(str, str + len, temp);
-        temp[len] = CharT{};
-    } catch (...) {
-        delete[] temp;
-        throw;
-    }
-
-    _data = temp;
-    _length = len;
-    _capacity = len + 1;
+    _init(str, len);
 }
 
-template<typename CharT> basic_string<CharT>::basic_string(const CharT* str) {
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>::basic_string(const CharT* str, const Allocator& alloc)
+    : _alloc{alloc} {
     assert(str);
 
     size_t len{};
@@ -114,60 +194,83 @@ template<typename CharT> basic_string<CharT>::basic_string(const CharT* str) {
         ++len;
     }
 
-    auto* temp{new CharT[len + 1]};
-
-    try {
-        std::copy(str, str + len + 1, temp);
-    } catch (...) {
-        delete[] temp;
-        throw;
-    }
+    _init(str, len);
+}
 
-    _capacity = len + 1;
-    _length = len;
-    _data = temp;
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>::basic_string(const basic_string& other)
+    : _alloc{alloc_traits::select_on_container_copy_construction(other._alloc)} {
+    _init(other._ptr(), other.size());
 }
 
-template<typename CharT> basic_string<CharT>::basic_string(const basic_string& other) {
-    auto* temp{new CharT[other._length + 1]};
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>::basic_string(basic_string&& other) noexcept
+    : _rep{other._rep}, _alloc{other._alloc} {
+    other._rep = {};
+}
 
-    try {
-        std::copy(other._data, other._data + other._length + 1, temp);
-    } catch (...) {
-        delete[] temp;
-        throw;
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>::basic_string(size_t count, CharT c, const Allocator& alloc)
+    : _alloc{alloc} {
+    if (count > inline_capacity) {
+        _set_heap(_allocate(count + 1), count, count);
     }
 
-    _data = temp;
-    _length = other._length;
-    _capacity = other._length + 1;
-}
-
-template<typename CharT> basic_string<CharT>::basic_string(basic_string&& other) noexcept {
-    _data = other._data;
-    _capacity = other._capacity;
-    _length = other._length;
+    auto* data{_ptr()};
+    for (size_t i = 0; i < count; ++i)
+        data[i] = c;
 
-    other._data = new CharT[1]{CharT{}};
-    other._capacity = 1;
-    other._length = 0;
+    _set_size(count);
 }
 
-template<typename CharT>
-basic_string<CharT>::basic_string(size_t count, CharT c)
-    : _data(new CharT[count + 1]), _capacity(count + 1), _length(count) {
-    for (size_t i = 0; i < count; ++i)
-        _data[i] = c;
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>::basic_string(view_type view, const Allocator& alloc)
+    : _alloc{alloc} {
+    _init(view.data(), view.size());
+}
 
-    _data[count] = CharT{};
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>&
+basic_string<CharT, Allocator>::operator=(const basic_string& other) {
+    if (this != &other) {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+            // Our buffer has to go back to the allocator that handed it out.
+            if (_alloc != other._alloc) {
+                _release();
+            }
+            _alloc = other._alloc;
+        }
+        _assign(other._ptr(), other.size());
+    }
+    return *this;
 }
 
-template<typename CharT> basic_string<CharT>& basic_string<CharT>::operator=(basic_string other) {
-    swap(*this, other);
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>& basic_string<CharT, Allocator>::operator=(
+    basic_string&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                   alloc_traits::is_always_equal::value) {
+    if (this != &other) {
+        if constexpr (!alloc_traits::propagate_on_container_move_assignment::value &&
+                      !alloc_traits::is_always_equal::value) {
+            // The buffer belongs to an allocator we can not take over, so copy the characters.
+            if (_alloc != other._alloc) {
+                _assign(other._ptr(), other.size());
+                return *this;
+            }
+        }
+
+        _release();
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+            _alloc = std::move(other._alloc);
+        }
+        _rep = other._rep;
+        other._rep = {};
+    }
     return *this;
 }
 
-template<typename CharT> basic_string<CharT>& basic_string<CharT>::operator=(const CharT* str) {
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>& basic_string<CharT, Allocator>::operator=(const CharT* str) {
     assert(str != nullptr);
 
     size_t len{};
@@ -175,170 +278,423 @@ template<typename CharT> basic_string<CharT>& basic_string<CharT>::operator=(con
         ++len;
     }
 
-    auto* temp{new CharT[len + 1]};
-    try {
-        std::copy(str, str + len + 1, temp);
-    } catch (...) {
-        delete[] temp;
-        throw;
-    }
-    delete[] _data;
-    _data = temp;
-    _length = len;
-    _capacity = len + 1;
+    _assign(str, len);
     return *this;
 }
 
-template<typename CharT> size_t basic_string<CharT>::size() const noexcept {
-    return _length;
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::size() const noexcept {
+    if (_is_inline()) {
+        return little_endian ? _rep.local.tag >> 1 : _rep.local.tag;
+    }
+    return _rep.heap.size;
+}
+
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::length() const noexcept {
+    return size();
 }
 
-template<typename CharT> size_t basic_string<CharT>::length() const noexcept {
-    return _length;
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::max_size() const noexcept {
+    // One bit of the capacity is taken by the layout flag and one element by the terminator.
+    constexpr size_t encodable{std::numeric_limits<size_t>::max() >> 1};
+    return std::min<size_t>(alloc_traits::max_size(_alloc), encodable) - 1;
 }
 
-template<typename CharT> const CharT* basic_string<CharT>::data() const noexcept {
-    return _data;
+template<typename CharT, typename Allocator>
+const CharT* basic_string<CharT, Allocator>::data() const noexcept {
+    return _ptr();
 }
 
-template<typename CharT> const CharT* basic_string<CharT>::c_str() const noexcept {
+template<typename CharT, typename Allocator>
+const CharT* basic_string<CharT, Allocator>::c_str() const noexcept {
     return data();
 }
 
-template<typename CharT> CharT& basic_string<CharT>::operator[](size_t pos) {
-    return _data[pos];
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>::operator view_type() const noexcept {
+    return {_ptr(), size()};
+}
+
+template<typename CharT, typename Allocator>
+CharT& basic_string<CharT, Allocator>::operator[](size_t pos) {
+    return _ptr()[pos];
 }
 
-template<typename CharT> const CharT& basic_string<CharT>::operator[](size_t pos) const {
-    return _data[pos];
+template<typename CharT, typename Allocator>
+const CharT& basic_string<CharT, Allocator>::operator[](size_t pos) const {
+    return _ptr()[pos];
 }
 
-template<typename CharT> CharT& basic_string<CharT>::at(size_t pos) {
-    if (pos >= _length) {
+template<typename CharT, typename Allocator> CharT& basic_string<CharT, Allocator>::at(size_t pos) {
+    if (pos >= size()) {
         throw std::out_of_range("basic_string::at: index out of range");
     }
 
-    return _data[pos];
+    return _ptr()[pos];
 }
 
-template<typename CharT> const CharT& basic_string<CharT>::at(size_t pos) const {
-    if (pos >= _length) {
+template<typename CharT, typename Allocator>
+const CharT& basic_string<CharT, Allocator>::at(size_t pos) const {
+    if (pos >= size()) {
         throw std::out_of_range("basic_string::at: index out of range");
     }
 
-    return _data[pos];
+    return _ptr()[pos];
 }
 
-template<typename CharT> bool basic_string<CharT>::empty() const noexcept {
-    return _length == 0;
+template<typename CharT, typename Allocator>
+bool basic_string<CharT, Allocator>::empty() const noexcept {
+    return size() == 0;
 }
 
-template<typename CharT> void basic_string<CharT>::push_back(CharT ch) {
-    if (_length + 1 >= _capacity) {
-        reserve(std::max(_capacity * 2, _length + 2));
+template<typename CharT, typename Allocator>
+void basic_string<CharT, Allocator>::push_back(CharT ch) {
+    const auto len{size()};
+    if (len == capacity()) {
+        if (len == max_size()) {
+            throw std::length_error("basic_string::push_back: length exceeds max_size()");
+        }
+        reserve(_grown_capacity(len + 1));
     }
 
-    _data[_length] = ch;
-    _data[_length + 1] = CharT{};
-    ++_length;
+    _ptr()[len] = ch;
+    _set_size(len + 1);
 }
 
-template<typename CharT> void basic_string<CharT>::pop_back() {
-    if (_length > 0) {
-        --_length;
-        _data[_length] = CharT{};
+template<typename CharT, typename Allocator> void basic_string<CharT, Allocator>::pop_back() {
+    const auto len{size()};
+    if (len > 0) {
+        _set_size(len - 1);
     }
 }
 
-template<typename CharT> basic_string<CharT>& basic_string<CharT>::append(const CharT* str) {
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>& basic_string<CharT, Allocator>::append(const CharT* str) {
     assert(str != nullptr);
+    return append(str, std::char_traits<CharT>::length(str));
+}
 
-    size_t len{};
-
-    while (str[len]) {
-        ++len;
+// `str` may point into this string: when growing, the old buffer is released only after the
+// new characters have been copied out of it.
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>& basic_string<CharT, Allocator>::append(const CharT* str,
+                                                                       size_t count) {
+    const auto old_len{size()};
+    if (count > max_size() - old_len) {
+        throw std::length_error("basic_string::append: length exceeds max_size()");
     }
 
-    if (_length + len >= _capacity) {
-        reserve(std::max(_capacity * 2, _length + len + 1));
+    const auto new_len{old_len + count};
+    if (new_len <= capacity()) {
+        std::copy(str, str + count, _ptr() + old_len);
+        _set_size(new_len);
+        return *this;
     }
 
-    std::copy(str, str + len + 1, _data + _length);
-    _length += len;
+    const auto old_cap{capacity()};
+    const auto new_cap{_grown_capacity(new_len)};
+    auto* temp{_allocate(new_cap + 1)};
+
+    std::copy(_ptr(), _ptr() + old_len, temp);
+    std::copy(str, str + count, temp + old_len);
+
+    if (!_is_inline()) {
+        _deallocate(_rep.heap.data, old_cap + 1);
+    }
+    _set_heap(temp, new_len, new_cap);
 
     return *this;
 }
 
-template<typename CharT> basic_string<CharT>& basic_string<CharT>::operator+=(CharT ch) {
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>& basic_string<CharT, Allocator>::append(const basic_string& other) {
+    return append(other.data(), other.size());
+}
+
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>& basic_string<CharT, Allocator>::append(view_type view) {
+    return append(view.data(), view.size());
+}
+
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>& basic_string<CharT, Allocator>::operator+=(CharT ch) {
     push_back(ch);
     return *this;
 }
 
-template<typename CharT> basic_string<CharT>& basic_string<CharT>::operator+=(const CharT* str) {
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>& basic_string<CharT, Allocator>::operator+=(const CharT* str) {
     return append(str);
 }
 
-template<typename CharT>
-basic_string<CharT>& basic_string<CharT>::operator+=(const basic_string& other) {
-    return append(other.c_str());
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>&
+basic_string<CharT, Allocator>::operator+=(const basic_string& other) {
+    return append(other);
+}
+
+template<typename CharT, typename Allocator>
+basic_string<CharT, Allocator>& basic_string<CharT, Allocator>::operator+=(view_type view) {
+    return append(view);
 }
 
-template<typename CharT> void basic_string<CharT>::clear() {
-    _length = 0;
-    _data[0] = CharT{};
+template<typename CharT, typename Allocator>
+int basic_string<CharT, Allocator>::compare(view_type other) const noexcept {
+    return view_type{*this}.compare(other);
 }
 
-template<typename CharT> size_t basic_string<CharT>::capacity() const noexcept {
-    return _capacity;
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::find(view_type needle, size_t pos) const noexcept {
+    return view_type{*this}.find(needle, pos);
 }
 
-template<typename CharT> void basic_string<CharT>::reserve(size_t new_cap) {
-    if (new_cap <= _capacity) {
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::find(CharT ch, size_t pos) const noexcept {
+    return view_type{*this}.find(ch, pos);
+}
+
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::rfind(view_type needle, size_t pos) const noexcept {
+    return view_type{*this}.rfind(needle, pos);
+}
+
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::rfind(CharT ch, size_t pos) const noexcept {
+    return view_type{*this}.rfind(ch, pos);
+}
+
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::find_first_of(view_type set, size_t pos) const noexcept {
+    return view_type{*this}.find_first_of(set, pos);
+}
+
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::find_last_of(view_type set, size_t pos) const noexcept {
+    return view_type{*this}.find_last_of(set, pos);
+}
+
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::find_first_not_of(view_type set,
+                                                         size_t pos) const noexcept {
+    return view_type{*this}.find_first_not_of(set, pos);
+}
+
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::find_last_not_of(view_type set, size_t pos) const noexcept {
+    return view_type{*this}.find_last_not_of(set, pos);
+}
+
+template<typename CharT, typename Allocator> void basic_string<CharT, Allocator>::clear() {
+    _set_size(0);
+}
+
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::capacity() const noexcept {
+    if (_is_inline()) {
+        return inline_capacity;
+    }
+    return little_endian ? _rep.heap.capacity >> 1 : _rep.heap.capacity & ~capacity_flag;
+}
+
+template<typename CharT, typename Allocator>
+void basic_string<CharT, Allocator>::reserve(size_t new_cap) {
+    const auto old_cap{capacity()};
+    if (new_cap <= old_cap) {
         return;
     }
-    auto* temp{new CharT[new_cap]};
+    if (new_cap > max_size()) {
+        throw std::length_error("basic_string::reserve: capacity exceeds max_size()");
+    }
+    auto* temp{_allocate(new_cap + 1)};
+
+    const auto len{size()};
+    std::copy(_ptr(), _ptr() + len + 1, temp);
+
+    if (!_is_inline()) {
+        _deallocate(_rep.heap.data, old_cap + 1);
+    }
+    _set_heap(temp, len, new_cap);
+}
 
+// Makes room for `count` characters and lets `op(data, count)` write them directly, without
+// initializing them first. `op` returns the final size, which must not exceed `count`.
+template<typename CharT, typename Allocator>
+template<typename Operation>
+void basic_string<CharT, Allocator>::resize_and_overwrite(size_t count, Operation op) {
+    reserve(count);
+
+    size_t new_len{};
     try {
-        std::copy(_data, _data + _length + 1, temp);
+        new_len = static_cast<size_t>(std::move(op)(_ptr(), count));
     } catch (...) {
-        delete[] temp;
+        // `op` may have overwritten the terminator; the old contents are not recoverable anyway.
+        _set_size(0);
         throw;
     }
 
-    delete[] _data;
-    _data = temp;
-    _capacity = new_cap;
+    assert(new_len <= count);
+    _set_size(new_len);
+}
+
+template<typename CharT, typename Allocator>
+typename basic_string<CharT, Allocator>::allocator_type
+basic_string<CharT, Allocator>::get_allocator() const noexcept {
+    return _alloc;
+}
+
+template<typename CharT, typename Allocator> basic_string<CharT, Allocator>::~basic_string() {
+    if (!_is_inline()) {
+        _deallocate(_rep.heap.data, capacity() + 1);
+    }
+}
+
+template<typename CharT, typename Allocator>
+CharT* basic_string<CharT, Allocator>::begin() noexcept {
+    return _ptr();
+}
+
+template<typename CharT, typename Allocator>
+const CharT* basic_string<CharT, Allocator>::begin() const noexcept {
+    return _ptr();
+}
+
+template<typename CharT, typename Allocator>
+const CharT* basic_string<CharT, Allocator>::cbegin() const noexcept {
+    return _ptr();
+}
+
+template<typename CharT, typename Allocator> CharT* basic_string<CharT, Allocator>::end() noexcept {
+    return _ptr() + size();
+}
+
+template<typename CharT, typename Allocator>
+const CharT* basic_string<CharT, Allocator>::end() const noexcept {
+    return _ptr() + size();
+}
+
+template<typename CharT, typename Allocator>
+const CharT* basic_string<CharT, Allocator>::cend() const noexcept {
+    return _ptr() + size();
+}
+
+template<typename CharT, typename Allocator>
+bool basic_string<CharT, Allocator>::_is_inline() const noexcept {
+    return !(*reinterpret_cast<const unsigned char*>(&_rep) & tag_flag);
+}
+
+template<typename CharT, typename Allocator>
+CharT* basic_string<CharT, Allocator>::_ptr() noexcept {
+    return _is_inline() ? _rep.local.data : _rep.heap.data;
+}
+
+template<typename CharT, typename Allocator>
+const CharT* basic_string<CharT, Allocator>::_ptr() const noexcept {
+    return _is_inline() ? _rep.local.data : _rep.heap.data;
+}
+
+// Sets the size of either layout and writes the terminating null.
+template<typename CharT, typename Allocator>
+void basic_string<CharT, Allocator>::_set_size(size_t size) noexcept {
+    if (_is_inline()) {
+        _set_inline_size(size);
+    } else {
+        _rep.heap.size = size;
+        _rep.heap.data[size] = CharT{};
+    }
+}
+
+template<typename CharT, typename Allocator>
+void basic_string<CharT, Allocator>::_set_inline_size(size_t size) noexcept {
+    assert(size <= inline_capacity);
+    _rep.local.tag = static_cast<unsigned char>(little_endian ? size << 1 : size);
+    _rep.local.data[size] = CharT{};
 }
 
-template<typename CharT> basic_string<CharT>::~basic_string() {
-    delete[] _data;
+template<typename CharT, typename Allocator>
+void basic_string<CharT, Allocator>::_set_heap(CharT* data, size_t size,
+                                               size_t capacity) noexcept {
+    assert(capacity <= std::numeric_limits<size_t>::max() >> 1);
+    _rep.heap.capacity = little_endian ? capacity << 1 | capacity_flag : capacity | capacity_flag;
+    _rep.heap.size = size;
+    _rep.heap.data = data;
+    data[size] = CharT{};
 }
 
-template<typename CharT> CharT* basic_string<CharT>::begin() noexcept {
-    return _data;
+// Capacity to grow to so that `required` characters fit: doubles the current capacity, so a chain
+// of appends reallocates only O(log n) times. `required` must not exceed max_size().
+template<typename CharT, typename Allocator>
+size_t basic_string<CharT, Allocator>::_grown_capacity(size_t required) const noexcept {
+    const auto cap{capacity()};
+    const auto limit{max_size()};
+    if (cap > limit / 2) {
+        return limit;
+    }
+    return std::max(required, cap * 2);
 }
 
-template<typename CharT> const CharT* basic_string<CharT>::begin() const noexcept {
-    return _data;
+// Replaces the contents with `len` characters from `str`, which may point into the string itself.
+template<typename CharT, typename Allocator>
+void basic_string<CharT, Allocator>::_assign(const CharT* str, size_t len) {
+    // Reuse the current buffer when it is large enough.
+    if (len <= capacity()) {
+        auto* data{_ptr()};
+        std::memmove(data, str, len * sizeof(CharT));
+        _set_size(len);
+        return;
+    }
+
+    auto* temp{_allocate(len + 1)};
+    std::copy(str, str + len, temp);
+
+    if (!_is_inline()) {
+        _deallocate(_rep.heap.data, capacity() + 1);
+    }
+    _set_heap(temp, len, len);
 }
 
-template<typename CharT> const CharT* basic_string<CharT>::cbegin() const noexcept {
-    return _data;
+// Frees a heap buffer and leaves the string empty and inline.
+template<typename CharT, typename Allocator>
+void basic_string<CharT, Allocator>::_release() noexcept {
+    if (!_is_inline()) {
+        _deallocate(_rep.heap.data, capacity() + 1);
+    }
+    _rep = {};
 }
 
-template<typename CharT> CharT* basic_string<CharT>::end() noexcept {
-    return _data + _length;
+// Fills a freshly constructed (empty, inline) string.
+template<typename CharT, typename Allocator>
+void basic_string<CharT, Allocator>::_init(const CharT* str, size_t len) {
+    if (len <= inline_capacity) {
+        std::copy(str, str + len, _rep.local.data);
+        _set_inline_size(len);
+        return;
+    }
+
+    auto* temp{_allocate(len + 1)};
+    std::copy(str, str + len, temp);
+    _set_heap(temp, len, len);
 }
 
-template<typename CharT> const CharT* basic_string<CharT>::end() const noexcept {
-    return _data + _length;
+template<typename CharT, typename Allocator>
+CharT* basic_string<CharT, Allocator>::_allocate(size_t count) {
+    return alloc_traits::allocate(_alloc, count);
 }
 
-template<typename CharT> const CharT* basic_string<CharT>::cend() const noexcept {
-    return _data + _length;
+template<typename CharT, typename Allocator>
+void basic_string<CharT, Allocator>::_deallocate(CharT* ptr, size_t count) noexcept {
+    alloc_traits::deallocate(_alloc, ptr, count);
 }
 
 using string = basic_string<char>;
+using u16string = basic_string<char16_t>;
+using u32string = basic_string<char32_t>;
+
+// Inline characters are addressed through the tag, never through a pointer into the object.
+template<typename CharT, typename Allocator>
+struct is_trivially_relocatable<basic_string<CharT, Allocator>>
+    : is_trivially_relocatable<Allocator> {};
 
 } // namespace nstd
 
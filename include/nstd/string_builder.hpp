@@ -0,0 +1,220 @@
+#ifndef NSTD_STRING_BUILDER_HPP
+#define NSTD_STRING_BUILDER_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+
+namespace nstd {
+
+namespace detail {
+
+// Integers that are formatted as numbers; character types are appended as characters.
+template<typename T>
+concept formattable_integer =
+    std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+    !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t> &&
+    !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+} // namespace detail
+
+// Write buffer for assembling a string piece by piece (log lines, wire messages).
+//
+// The first InlineCapacity characters go into a buffer inside the builder, so short messages are
+// built without touching the heap. Longer ones spill into a heap buffer that grows geometrically,
+// and that buffer is the storage of the string returned by take(), which hands it over without
+// copying. Building and taking a message therefore costs at most one allocation for the final
+// string, plus one per doubling past the inline capacity.
+//
+// Numbers are formatted with std::to_chars: locale-independent and without intermediate strings.
+template<size_t InlineCapacity, typename Allocator = std::allocator<char>>
+class basic_string_builder {
+public:
+    using string_type = basic_string<char, Allocator>;
+
+    static constexpr size_t inline_capacity{InlineCapacity};
+
+    basic_string_builder() noexcept : basic_string_builder(Allocator()) {}
+
+    explicit basic_string_builder(const Allocator& alloc) noexcept : _heap{alloc} {}
+
+    // The data pointer may point into the builder itself.
+    basic_string_builder(const basic_string_builder&) = delete;
+    basic_string_builder& operator=(const basic_string_builder&) = delete;
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    size_t capacity() const noexcept {
+        return _capacity;
+    }
+
+    bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    // True while the contents still fit in the inline buffer.
+    bool is_inline() const noexcept {
+        return _data == _local;
+    }
+
+    const char* data() const noexcept {
+        return _data;
+    }
+
+    string_view view() const noexcept {
+        return {_data, _size};
+    }
+
+    operator string_view() const noexcept {
+        return view();
+    }
+
+    void reserve(size_t new_cap) {
+        if (new_cap > _capacity) {
+            _grow(new_cap);
+        }
+    }
+
+    // Empties the builder, keeping its buffer.
+    void clear() noexcept {
+        _size = 0;
+    }
+
+    basic_string_builder& append(string_view text) {
+        auto* out{_extend(text.size())};
+        std::memcpy(out, text.data(), text.size());
+        return *this;
+    }
+
+    basic_string_builder& append(char ch) {
+        *_extend(1) = ch;
+        return *this;
+    }
+
+    basic_string_builder& append(size_t count, char ch) {
+        std::memset(_extend(count), ch, count);
+        return *this;
+    }
+
+    // A template so that pointers do not convert to bool ahead of string_view.
+    template<std::same_as<bool> T> basic_string_builder& append(T value) {
+        return append(value ? string_view{"true"} : string_view{"false"});
+    }
+
+    template<detail::formattable_integer T> basic_string_builder& append(T value) {
+        return append_integer(value, 10);
+    }
+
+    // Digits in the given base (2 to 36), lowercase, with no prefix.
+    template<detail::formattable_integer T>
+    basic_string_builder& append_integer(T value, int base) {
+        _format([&](char* first, char* last) { return std::to_chars(first, last, value, base); });
+        return *this;
+    }
+
+    // Shortest representation that reads back as the same value.
+    template<std::floating_point T> basic_string_builder& append(T value) {
+        _format([&](char* first, char* last) { return std::to_chars(first, last, value); });
+        return *this;
+    }
+
+    template<std::floating_point T>
+    basic_string_builder& append(T value, std::chars_format format, int precision) {
+        _format([&](char* first, char* last) {
+            return std::to_chars(first, last, value, format, precision);
+        });
+        return *this;
+    }
+
+    template<typename T>
+    basic_string_builder& operator<<(const T& value)
+        requires requires(basic_string_builder& builder) { builder.append(value); }
+    {
+        return append(value);
+    }
+
+    // Moves the contents out as a string and leaves the builder empty. A spilled buffer becomes
+    // the string's storage; inline contents are copied, allocating only if they exceed the
+    // string's own inline capacity.
+    string_type take() {
+        string_type result{_heap.get_allocator()};
+        if (is_inline()) {
+            result.append(view());
+        } else {
+            _heap.resize_and_overwrite(_size, [size = _size](char*, size_t) { return size; });
+            swap(result, _heap);
+            _data = _local;
+            _capacity = InlineCapacity;
+        }
+        _size = 0;
+        return result;
+    }
+
+private:
+    // Room for `count` more characters, returned as a pointer to the first of them.
+    char* _extend(size_t count) {
+        if (count > _capacity - _size) {
+            if (count > _heap.max_size() - _size) {
+                throw std::length_error("basic_string_builder: length exceeds max_size()");
+            }
+            _grow(std::max(_size + count, _capacity * 2));
+        }
+        auto* out{_data + _size};
+        _size += count;
+        return out;
+    }
+
+    // Retries into a buffer twice as large until the text fits.
+    template<typename Format> void _format(Format format) {
+        for (;;) {
+            const auto [end, error]{format(_data + _size, _data + _capacity)};
+            if (error == std::errc{}) {
+                _size = static_cast<size_t>(end - _data);
+                return;
+            }
+            _grow(std::max(_capacity * 2, _size + 32));
+        }
+    }
+
+    // Moves the contents to a heap buffer of exactly `new_cap` characters. The buffer is the
+    // storage of _heap, whose size is kept equal to its capacity so that all of it is writable.
+    void _grow(size_t new_cap) {
+        auto fill = [](char*, size_t count) { return count; };
+        if (is_inline()) {
+            _heap.resize_and_overwrite(new_cap, [this](char* out, size_t count) {
+                std::memcpy(out, _local, _size);
+                return count;
+            });
+        } else {
+            // Trim first so that only the used characters are copied.
+            _heap.resize_and_overwrite(_size, fill);
+            _heap.resize_and_overwrite(new_cap, fill);
+        }
+        _data = _heap.begin();
+        _capacity = _heap.size();
+    }
+
+    char* _data{_local};
+    size_t _size{};
+    size_t _capacity{InlineCapacity};
+    string_type _heap;
+    char _local[InlineCapacity];
+};
+
+using string_builder = basic_string_builder<512>;
+
+} // namespace nstd
+
+#endif // NSTD_STRING_BUILDER_HPP
@@ -0,0 +1,308 @@
+#ifndef NSTD_STRING_POOL_HPP
+#define NSTD_STRING_POOL_HPP
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "nstd/arena.hpp"
+#include "nstd/hash.hpp"
+#include "nstd/memory_pool.hpp"
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+#include "nstd/vector.hpp"
+
+namespace nstd {
+
+namespace detail {
+
+// Header stored in front of the characters of every pooled string (which follow it directly and
+// are null-terminated).
+struct interned_entry {
+    std::uint64_t hash;
+    std::uint32_t size;
+    std::uint32_t id;
+
+    const char* chars() const noexcept {
+        return reinterpret_cast<const char*>(this + 1);
+    }
+};
+
+struct empty_interned_entry {
+    interned_entry header;
+    char terminator;
+};
+
+inline constexpr empty_interned_entry empty_interned{{0, 0, 0}, '\0'};
+
+} // namespace detail
+
+// Handle to a string stored in a string_pool: a single pointer, so it is as cheap to copy and
+// store as a raw pointer. Equal strings interned in the same pool share one handle, which makes
+// equality a pointer comparison. The default handle is the empty string, with id 0.
+//
+// A handle stays valid for as long as its pool.
+class interned_string {
+public:
+    interned_string() noexcept : _entry{&detail::empty_interned.header} {}
+
+    string_view view() const noexcept {
+        return {_entry->chars(), _entry->size};
+    }
+
+    operator string_view() const noexcept {
+        return view();
+    }
+
+    const char* c_str() const noexcept {
+        return _entry->chars();
+    }
+
+    size_t size() const noexcept {
+        return _entry->size;
+    }
+
+    bool empty() const noexcept {
+        return _entry->size == 0;
+    }
+
+    // Dense 32-bit id, unique within the pool; string_pool::lookup() maps it back.
+    std::uint32_t id() const noexcept {
+        return _entry->id;
+    }
+
+    size_t hash() const noexcept {
+        return static_cast<size_t>(_entry->hash);
+    }
+
+    friend bool operator==(interned_string first, interned_string second) noexcept {
+        return first._entry == second._entry;
+    }
+
+private:
+    friend class string_pool;
+
+    explicit interned_string(const detail::interned_entry* entry) noexcept : _entry{entry} {}
+
+    const detail::interned_entry* _entry;
+};
+
+// Deduplicating string storage (symbol table).
+//
+// intern() returns the one handle for a given string, copying the characters in on first sight
+// only. The characters live in per-shard arenas, packed back to back in large blocks, so a pooled
+// string costs its characters plus a 16-byte header and a few bytes of index, and every duplicate
+// just a pointer.
+//
+// Interning is thread-safe. Strings are spread over 16 shards by hash, each with its own lock,
+// arena and open-addressing index, so threads interning different strings rarely contend.
+// lookup() is lock-free. Nothing is freed before the pool itself is destroyed.
+class string_pool {
+    static constexpr size_t shard_bits{4};
+    static constexpr size_t shard_count{size_t{1} << shard_bits};
+
+    // Ids are 1 + (index within the shard << shard_bits | shard). The per-shard id -> entry
+    // directory is a list of segments that double in size and never move, so lookup() can read
+    // it while another thread appends.
+    static constexpr size_t first_segment_size{1024};
+    static constexpr size_t max_segments{
+        std::numeric_limits<std::uint32_t>::digits - shard_bits -
+        std::bit_width(first_segment_size - 1)};
+
+    struct slot {
+        std::uint64_t hash;
+        const detail::interned_entry* entry;
+    };
+
+    struct alignas(cache_line_size) shard {
+        explicit shard(size_t block_size) : storage{block_size} {}
+
+        std::mutex mtx{};
+        arena storage;
+        nstd::vector<slot> index{};
+        size_t count{};
+        std::atomic<const detail::interned_entry**> segments[max_segments]{};
+    };
+
+public:
+    explicit string_pool(size_t block_size = 64 * 1024) {
+        for (size_t i = 0; i < shard_count; ++i) {
+            _shards[i] = new shard{block_size};
+        }
+    }
+
+    string_pool(const string_pool&) = delete;
+    string_pool& operator=(const string_pool&) = delete;
+
+    ~string_pool() {
+        for (auto* s : _shards) {
+            for (size_t segment = 0; segment < max_segments; ++segment) {
+                delete[] s->segments[segment].load(std::memory_order_relaxed);
+            }
+            delete s;
+        }
+    }
+
+    interned_string intern(string_view str) {
+        if (str.empty()) {
+            return {};
+        }
+
+        const auto hash{hash_bytes(str.data(), str.size())};
+        const auto shard_index{static_cast<size_t>(hash >> (64 - shard_bits))};
+        auto& s{*_shards[shard_index]};
+
+        std::lock_guard lock{s.mtx};
+        if (const auto* found{_find(s, hash, str)}) {
+            return interned_string{found};
+        }
+        return interned_string{_insert(s, shard_index, hash, str)};
+    }
+
+    // The handle for `str` if it was interned before, without adding it.
+    interned_string find(string_view str) const {
+        if (str.empty()) {
+            return {};
+        }
+
+        const auto hash{hash_bytes(str.data(), str.size())};
+        auto& s{*_shards[hash >> (64 - shard_bits)]};
+
+        std::lock_guard lock{s.mtx};
+        const auto* found{_find(s, hash, str)};
+        return found ? interned_string{found} : interned_string{};
+    }
+
+    bool contains(string_view str) const {
+        return str.empty() || !find(str).empty();
+    }
+
+    // The handle with the given id, which must come from this pool.
+    interned_string lookup(std::uint32_t id) const noexcept {
+        if (id == 0) {
+            return {};
+        }
+
+        const size_t raw{id - 1u};
+        const auto& s{*_shards[raw & (shard_count - 1)]};
+        const auto [segment, offset]{_locate(raw >> shard_bits)};
+        const auto* entries{s.segments[segment].load(std::memory_order_acquire)};
+        assert(entries && entries[offset]);
+        return interned_string{entries[offset]};
+    }
+
+    // Number of distinct non-empty strings in the pool.
+    size_t size() const {
+        size_t total{};
+        for (auto* s : _shards) {
+            std::lock_guard lock{s->mtx};
+            total += s->count;
+        }
+        return total;
+    }
+
+private:
+    static const detail::interned_entry* _find(const shard& s, std::uint64_t hash,
+                                               string_view str) noexcept {
+        if (s.index.is_empty()) {
+            return nullptr;
+        }
+
+        const auto mask{s.index.size() - 1};
+        for (auto i{static_cast<size_t>(hash) & mask};; i = (i + 1) & mask) {
+            const auto& candidate{s.index[i]};
+            if (!candidate.entry) {
+                return nullptr;
+            }
+            if (candidate.hash == hash && candidate.entry->size == str.size() &&
+                std::memcmp(candidate.entry->chars(), str.data(), str.size()) == 0) {
+                return candidate.entry;
+            }
+        }
+    }
+
+    const detail::interned_entry* _insert(shard& s, size_t shard_index, std::uint64_t hash,
+                                          string_view str) {
+        if (str.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("string_pool::intern: string too long");
+        }
+
+        const auto local{s.count};
+        const auto [segment, offset]{_locate(local)};
+        if (segment >= max_segments) {
+            throw std::length_error("string_pool::intern: too many strings");
+        }
+
+        // Keep the index at most half full.
+        if ((s.count + 1) * 2 > s.index.size()) {
+            _grow_index(s);
+        }
+
+        auto* entries{s.segments[segment].load(std::memory_order_relaxed)};
+        if (!entries) {
+            entries = new const detail::interned_entry*[first_segment_size << segment]{};
+            s.segments[segment].store(entries, std::memory_order_release);
+        }
+
+        auto* memory{static_cast<std::byte*>(
+            s.storage.allocate(sizeof(detail::interned_entry) + str.size() + 1,
+                               alignof(detail::interned_entry)))};
+        auto* entry{new (memory) detail::interned_entry{
+            hash, static_cast<std::uint32_t>(str.size()),
+            static_cast<std::uint32_t>(((local << shard_bits) | shard_index) + 1)}};
+        auto* chars{memory + sizeof(detail::interned_entry)};
+        std::memcpy(chars, str.data(), str.size());
+        chars[str.size()] = std::byte{};
+
+        entries[offset] = entry;
+        _place(s.index, slot{hash, entry});
+        ++s.count;
+        return entry;
+    }
+
+    static void _grow_index(shard& s) {
+        nstd::vector<slot> bigger(std::max<size_t>(s.index.size() * 2, 64), slot{0, nullptr});
+        for (const auto& old : s.index) {
+            if (old.entry) {
+                _place(bigger, old);
+            }
+        }
+        swap(s.index, bigger);
+    }
+
+    static void _place(nstd::vector<slot>& index, slot value) noexcept {
+        const auto mask{index.size() - 1};
+        auto i{static_cast<size_t>(value.hash) & mask};
+        while (index[i].entry) {
+            i = (i + 1) & mask;
+        }
+        index[i] = value;
+    }
+
+    // Segment k holds first_segment_size << k entries, starting at first_segment_size * (2^k - 1).
+    static std::pair<size_t, size_t> _locate(size_t local) noexcept {
+        const auto segment{static_cast<size_t>(std::bit_width(local / first_segment_size + 1)) - 1};
+        return {segment, local - first_segment_size * ((size_t{1} << segment) - 1)};
+    }
+
+    shard* _shards[shard_count]{};
+};
+
+} // namespace nstd
+
+template<> struct std::hash<nstd::interned_string> {
+    size_t operator()(nstd::interned_string str) const noexcept {
+        return str.hash();
+    }
+};
+
+#endif // NSTD_STRING_POOL_HPP
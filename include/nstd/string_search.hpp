@@ -0,0 +1,279 @@
+#ifndef NSTD_STRING_SEARCH_HPP
+#define NSTD_STRING_SEARCH_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define NSTD_SIMD_CHARS 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define NSTD_SIMD_CHARS 1
+#endif
+
+namespace nstd {
+namespace detail {
+
+// Search kernels over raw `char` ranges [first, last), used by basic_string_view<char>. Each one
+// returns a pointer to the match or nullptr.
+//
+// The vector width is chosen at compile time: AVX2 when the translation unit is built with it
+// (e.g. -mavx2 or -march=native), otherwise SSE2, which every x86-64 target has. Other targets use
+// the scalar loops only.
+
+#if defined(NSTD_SIMD_CHARS)
+#if defined(__AVX2__)
+struct simd_chars {
+    using reg = __m256i;
+    static constexpr std::ptrdiff_t width{32};
+
+    static reg load(const char* ptr) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    }
+
+    static reg splat(char ch) noexcept {
+        return _mm256_set1_epi8(ch);
+    }
+
+    // Bit i is set when byte i of both registers is equal.
+    static std::uint32_t eq(reg first, reg second) noexcept {
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(first, second)));
+    }
+
+    static constexpr std::uint32_t all{0xFFFFFFFFu};
+};
+#else
+struct simd_chars {
+    using reg = __m128i;
+    static constexpr std::ptrdiff_t width{16};
+
+    static reg load(const char* ptr) noexcept {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    }
+
+    static reg splat(char ch) noexcept {
+        return _mm_set1_epi8(ch);
+    }
+
+    static std::uint32_t eq(reg first, reg second) noexcept {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(first, second)));
+    }
+
+    static constexpr std::uint32_t all{0xFFFFu};
+};
+#endif
+
+inline int highest_bit(std::uint32_t mask) noexcept {
+    return std::bit_width(mask) - 1;
+}
+#endif
+
+inline const char* find_char(const char* first, const char* last, char ch) noexcept {
+#if defined(NSTD_SIMD_CHARS)
+    const auto target{simd_chars::splat(ch)};
+    for (; last - first >= simd_chars::width; first += simd_chars::width) {
+        if (const auto mask{simd_chars::eq(simd_chars::load(first), target)}) {
+            return first + std::countr_zero(mask);
+        }
+    }
+#endif
+    for (; first != last; ++first) {
+        if (*first == ch) {
+            return first;
+        }
+    }
+    return nullptr;
+}
+
+inline const char* rfind_char(const char* first, const char* last, char ch) noexcept {
+#if defined(NSTD_SIMD_CHARS)
+    const auto target{simd_chars::splat(ch)};
+    for (; last - first >= simd_chars::width; last -= simd_chars::width) {
+        const auto* block{last - simd_chars::width};
+        if (const auto mask{simd_chars::eq(simd_chars::load(block), target)}) {
+            return block + highest_bit(mask);
+        }
+    }
+#endif
+    while (last != first) {
+        if (*--last == ch) {
+            return last;
+        }
+    }
+    return nullptr;
+}
+
+// First/last character filter: a block of candidate start positions is compared against the
+// needle's first and last characters at once, and only positions passing both get a full
+// comparison. Needles of length 1 go through find_char.
+inline const char* find_substring(const char* first, const char* last, const char* needle,
+                                  size_t count) noexcept {
+    if (count == 1) {
+        return find_char(first, last, needle[0]);
+    }
+
+    // Candidate starts are [first, stop).
+    const auto* stop{last - count + 1};
+#if defined(NSTD_SIMD_CHARS)
+    const auto head{simd_chars::splat(needle[0])};
+    const auto tail{simd_chars::splat(needle[count - 1])};
+    for (; stop - first >= simd_chars::width; first += simd_chars::width) {
+        auto mask{simd_chars::eq(simd_chars::load(first), head) &
+                  simd_chars::eq(simd_chars::load(first + count - 1), tail)};
+        while (mask) {
+            const auto* candidate{first + std::countr_zero(mask)};
+            if (std::memcmp(candidate + 1, needle + 1, count - 2) == 0) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; first != stop; ++first) {
+        if (*first == needle[0] && first[count - 1] == needle[count - 1] &&
+            std::memcmp(first + 1, needle + 1, count - 2) == 0) {
+            return first;
+        }
+    }
+    return nullptr;
+}
+
+// Last match starting in [first, stop), where stop + count - 1 must not pass the end of the data.
+inline const char* rfind_substring(const char* first, const char* stop, const char* needle,
+                                   size_t count) noexcept {
+    if (count == 1) {
+        return rfind_char(first, stop, needle[0]);
+    }
+
+#if defined(NSTD_SIMD_CHARS)
+    const auto head{simd_chars::splat(needle[0])};
+    const auto tail{simd_chars::splat(needle[count - 1])};
+    for (; stop - first >= simd_chars::width; stop -= simd_chars::width) {
+        const auto* block{stop - simd_chars::width};
+        auto mask{simd_chars::eq(simd_chars::load(block), head) &
+                  simd_chars::eq(simd_chars::load(block + count - 1), tail)};
+        while (mask) {
+            const auto bit{highest_bit(mask)};
+            if (std::memcmp(block + bit + 1, needle + 1, count - 2) == 0) {
+                return block + bit;
+            }
+            mask &= ~(std::uint32_t{1} << bit);
+        }
+    }
+#endif
+    while (stop != first) {
+        --stop;
+        if (*stop == needle[0] && stop[count - 1] == needle[count - 1] &&
+            std::memcmp(stop + 1, needle + 1, count - 2) == 0) {
+            return stop;
+        }
+    }
+    return nullptr;
+}
+
+// Sets of up to this many characters are matched with one vector compare per member; larger
+// sets use a 256-entry lookup table.
+inline constexpr size_t simd_set_limit{8};
+
+class char_set {
+public:
+    char_set(const char* set, size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            _member[static_cast<unsigned char>(set[i])] = true;
+        }
+    }
+
+    bool contains(char ch) const noexcept {
+        return _member[static_cast<unsigned char>(ch)];
+    }
+
+private:
+    bool _member[256]{};
+};
+
+#if defined(NSTD_SIMD_CHARS)
+// Bit i is set when byte i of `block` is in the set.
+inline std::uint32_t set_mask(simd_chars::reg block, const simd_chars::reg* set,
+                              size_t count) noexcept {
+    std::uint32_t mask{};
+    for (size_t i = 0; i < count; ++i) {
+        mask |= simd_chars::eq(block, set[i]);
+    }
+    return mask;
+}
+#endif
+
+// First character that is (InSet) or is not (!InSet) one of `set`.
+template<bool InSet>
+const char* find_of(const char* first, const char* last, const char* set, size_t count) noexcept {
+    if (InSet && count == 1) {
+        return find_char(first, last, set[0]);
+    }
+
+#if defined(NSTD_SIMD_CHARS)
+    if (count <= simd_set_limit) {
+        simd_chars::reg members[simd_set_limit];
+        for (size_t i = 0; i < count; ++i) {
+            members[i] = simd_chars::splat(set[i]);
+        }
+        for (; last - first >= simd_chars::width; first += simd_chars::width) {
+            auto mask{set_mask(simd_chars::load(first), members, count)};
+            if (!InSet) {
+                mask = ~mask & simd_chars::all;
+            }
+            if (mask) {
+                return first + std::countr_zero(mask);
+            }
+        }
+    }
+#endif
+    const char_set members{set, count};
+    for (; first != last; ++first) {
+        if (members.contains(*first) == InSet) {
+            return first;
+        }
+    }
+    return nullptr;
+}
+
+// Last character that is (InSet) or is not (!InSet) one of `set`.
+template<bool InSet>
+const char* rfind_of(const char* first, const char* last, const char* set, size_t count) noexcept {
+    if (InSet && count == 1) {
+        return rfind_char(first, last, set[0]);
+    }
+
+#if defined(NSTD_SIMD_CHARS)
+    if (count <= simd_set_limit) {
+        simd_chars::reg members[simd_set_limit];
+        for (size_t i = 0; i < count; ++i) {
+            members[i] = simd_chars::splat(set[i]);
+        }
+        for (; last - first >= simd_chars::width; last -= simd_chars::width) {
+            const auto* block{last - simd_chars::width};
+            auto mask{set_mask(simd_chars::load(block), members, count)};
+            if (!InSet) {
+                mask = ~mask & simd_chars::all;
+            }
+            if (mask) {
+                return block + highest_bit(mask);
+            }
+        }
+    }
+#endif
+    const char_set members{set, count};
+    while (last != first) {
+        if (members.contains(*--last) == InSet) {
+            return last;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace nstd
+
+#endif // NSTD_STRING_SEARCH_HPP
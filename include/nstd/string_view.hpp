@@ -0,0 +1,325 @@
+#ifndef NSTD_STRING_VIEW_HPP
+#define NSTD_STRING_VIEW_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <iosfwd>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "nstd/string_search.hpp"
+
+namespace nstd {
+
+// Non-owning, read-only reference to a run of characters: a pointer and a length. Parsing and
+// lookup code can take views instead of strings and slice them with substr() / remove_prefix()
+// without copying or rescanning for a terminator. The characters are not null-terminated in
+// general.
+//
+// The searches run on the SIMD kernels of string_search.hpp for `char` at run time, and on plain
+// loops for other character types and in constant expressions.
+template<typename CharT> class basic_string_view {
+    using traits = std::char_traits<CharT>;
+
+public:
+    using value_type = CharT;
+    using const_iterator = const CharT*;
+    using iterator = const_iterator;
+
+    static constexpr size_t npos{static_cast<size_t>(-1)};
+
+    constexpr basic_string_view() noexcept = default;
+    constexpr basic_string_view(const CharT* str, size_t count) noexcept
+        : _data{str}, _size{count} {}
+
+    constexpr basic_string_view(const CharT* str) noexcept
+        : _data{str}, _size{traits::length(str)} {
+        assert(str);
+    }
+
+    basic_string_view(std::nullptr_t) = delete;
+
+    constexpr const CharT* data() const noexcept {
+        return _data;
+    }
+
+    constexpr size_t size() const noexcept {
+        return _size;
+    }
+
+    constexpr size_t length() const noexcept {
+        return _size;
+    }
+
+    constexpr bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    constexpr const CharT& operator[](size_t pos) const noexcept {
+        assert(pos < _size);
+        return _data[pos];
+    }
+
+    constexpr const CharT& at(size_t pos) const {
+        if (pos >= _size) {
+            throw std::out_of_range("basic_string_view::at: index out of range");
+        }
+        return _data[pos];
+    }
+
+    constexpr const CharT& front() const noexcept {
+        assert(!empty());
+        return _data[0];
+    }
+
+    constexpr const CharT& back() const noexcept {
+        assert(!empty());
+        return _data[_size - 1];
+    }
+
+    constexpr const_iterator begin() const noexcept {
+        return _data;
+    }
+
+    constexpr const_iterator end() const noexcept {
+        return _data + _size;
+    }
+
+    constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    constexpr void remove_prefix(size_t count) noexcept {
+        assert(count <= _size);
+        _data += count;
+        _size -= count;
+    }
+
+    constexpr void remove_suffix(size_t count) noexcept {
+        assert(count <= _size);
+        _size -= count;
+    }
+
+    // The characters [pos, pos + count), clamped to the end of the view.
+    constexpr basic_string_view substr(size_t pos = 0, size_t count = npos) const {
+        if (pos > _size) {
+            throw std::out_of_range("basic_string_view::substr: position out of range");
+        }
+        return {_data + pos, std::min(count, _size - pos)};
+    }
+
+    // Negative, zero or positive as this view orders before, equal to or after `other`.
+    constexpr int compare(basic_string_view other) const noexcept {
+        const int result{traits::compare(_data, other._data, std::min(_size, other._size))};
+        if (result != 0) {
+            return result;
+        }
+        return _size < other._size ? -1 : (_size > other._size ? 1 : 0);
+    }
+
+    constexpr bool starts_with(basic_string_view prefix) const noexcept {
+        return _size >= prefix._size && traits::compare(_data, prefix._data, prefix._size) == 0;
+    }
+
+    constexpr bool starts_with(CharT ch) const noexcept {
+        return !empty() && traits::eq(front(), ch);
+    }
+
+    constexpr bool ends_with(basic_string_view suffix) const noexcept {
+        return _size >= suffix._size &&
+               traits::compare(_data + _size - suffix._size, suffix._data, suffix._size) == 0;
+    }
+
+    constexpr bool ends_with(CharT ch) const noexcept {
+        return !empty() && traits::eq(back(), ch);
+    }
+
+    constexpr size_t find(CharT ch, size_t pos = 0) const noexcept {
+        if (pos >= _size) {
+            return npos;
+        }
+        if constexpr (std::is_same_v<CharT, char>) {
+            if (!std::is_constant_evaluated()) {
+                return _index(detail::find_char(_data + pos, _data + _size, ch));
+            }
+        }
+        return _index(traits::find(_data + pos, _size - pos, ch));
+    }
+
+    // Index of the first occurrence of `needle` at or after `pos`, or npos.
+    constexpr size_t find(basic_string_view needle, size_t pos = 0) const noexcept {
+        if (needle._size == 0) {
+            return pos <= _size ? pos : npos;
+        }
+        if (pos >= _size || needle._size > _size - pos) {
+            return npos;
+        }
+        if constexpr (std::is_same_v<CharT, char>) {
+            if (!std::is_constant_evaluated()) {
+                return _index(
+                    detail::find_substring(_data + pos, _data + _size, needle._data, needle._size));
+            }
+        }
+
+        // Jump between candidate first characters and only compare the rest at those.
+        const auto* last{_data + _size - needle._size};
+        for (const auto* it{_data + pos}; it <= last; ++it) {
+            it = traits::find(it, static_cast<size_t>(last - it) + 1, needle._data[0]);
+            if (!it) {
+                return npos;
+            }
+            if (traits::compare(it + 1, needle._data + 1, needle._size - 1) == 0) {
+                return static_cast<size_t>(it - _data);
+            }
+        }
+        return npos;
+    }
+
+    // Index of the last `ch` at or before `pos`, or npos.
+    constexpr size_t rfind(CharT ch, size_t pos = npos) const noexcept {
+        return find_last_of(basic_string_view{&ch, 1}, pos);
+    }
+
+    // Index of the last occurrence of `needle` starting at or before `pos`, or npos.
+    constexpr size_t rfind(basic_string_view needle, size_t pos = npos) const noexcept {
+        if (needle._size > _size) {
+            return npos;
+        }
+        const auto start{std::min(pos, _size - needle._size)};
+        if (needle._size == 0) {
+            return start;
+        }
+        if constexpr (std::is_same_v<CharT, char>) {
+            if (!std::is_constant_evaluated()) {
+                return _index(
+                    detail::rfind_substring(_data, _data + start + 1, needle._data, needle._size));
+            }
+        }
+        for (auto i{start + 1}; i-- > 0;) {
+            if (traits::compare(_data + i, needle._data, needle._size) == 0) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    // First character at or after `pos` that is one of `set`.
+    constexpr size_t find_first_of(basic_string_view set, size_t pos = 0) const noexcept {
+        return set.empty() ? npos : _find_of<true>(set, pos);
+    }
+
+    constexpr size_t find_first_of(CharT ch, size_t pos = 0) const noexcept {
+        return find(ch, pos);
+    }
+
+    // Last character at or before `pos` that is one of `set`.
+    constexpr size_t find_last_of(basic_string_view set, size_t pos = npos) const noexcept {
+        return set.empty() ? npos : _rfind_of<true>(set, pos);
+    }
+
+    constexpr size_t find_last_of(CharT ch, size_t pos = npos) const noexcept {
+        return rfind(ch, pos);
+    }
+
+    // First character at or after `pos` that is not one of `set`.
+    constexpr size_t find_first_not_of(basic_string_view set, size_t pos = 0) const noexcept {
+        return _find_of<false>(set, pos);
+    }
+
+    constexpr size_t find_first_not_of(CharT ch, size_t pos = 0) const noexcept {
+        return _find_of<false>(basic_string_view{&ch, 1}, pos);
+    }
+
+    // Last character at or before `pos` that is not one of `set`.
+    constexpr size_t find_last_not_of(basic_string_view set, size_t pos = npos) const noexcept {
+        return _rfind_of<false>(set, pos);
+    }
+
+    constexpr size_t find_last_not_of(CharT ch, size_t pos = npos) const noexcept {
+        return _rfind_of<false>(basic_string_view{&ch, 1}, pos);
+    }
+
+    constexpr bool contains(basic_string_view needle) const noexcept {
+        return find(needle) != npos;
+    }
+
+    constexpr bool contains(CharT ch) const noexcept {
+        return find(ch) != npos;
+    }
+
+    friend constexpr bool operator==(basic_string_view first, basic_string_view second) noexcept {
+        return first._size == second._size &&
+               traits::compare(first._data, second._data, first._size) == 0;
+    }
+
+    friend constexpr std::strong_ordering operator<=>(basic_string_view first,
+                                                      basic_string_view second) noexcept {
+        return first.compare(second) <=> 0;
+    }
+
+    friend std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os,
+                                                 basic_string_view view) {
+        return os.write(view._data, static_cast<std::streamsize>(view._size));
+    }
+
+private:
+    constexpr size_t _index(const CharT* found) const noexcept {
+        return found ? static_cast<size_t>(found - _data) : npos;
+    }
+
+    template<bool InSet>
+    constexpr size_t _find_of(basic_string_view set, size_t pos) const noexcept {
+        if (pos >= _size) {
+            return npos;
+        }
+        if constexpr (std::is_same_v<CharT, char>) {
+            if (!std::is_constant_evaluated()) {
+                return _index(
+                    detail::find_of<InSet>(_data + pos, _data + _size, set._data, set._size));
+            }
+        }
+        for (auto i{pos}; i < _size; ++i) {
+            if ((traits::find(set._data, set._size, _data[i]) != nullptr) == InSet) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    template<bool InSet>
+    constexpr size_t _rfind_of(basic_string_view set, size_t pos) const noexcept {
+        if (_size == 0) {
+            return npos;
+        }
+        const auto end{std::min(pos, _size - 1) + 1};
+        if constexpr (std::is_same_v<CharT, char>) {
+            if (!std::is_constant_evaluated()) {
+                return _index(detail::rfind_of<InSet>(_data, _data + end, set._data, set._size));
+            }
+        }
+        for (auto i{end}; i-- > 0;) {
+            if ((traits::find(set._data, set._size, _data[i]) != nullptr) == InSet) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    const CharT* _data{};
+    size_t _size{};
+};
+
+using string_view = basic_string_view<char>;
+using u16string_view = basic_string_view<char16_t>;
+using u32string_view = basic_string_view<char32_t>;
+
+} // namespace nstd
+
+#endif // NSTD_STRING_VIEW_HPP
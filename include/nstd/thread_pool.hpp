@@ -2,7 +2,9 @@
 #define NSTD_THREAD_POOL_HPP
 
 #include <atomic>
+#include <climits>
 #include <condition_variable>
+#include <functional>
 #include <future>
 #include <iostream>
 #include <memory>
@@ -11,6 +13,7 @@
 #include <thread>
 #include <vector>
 
+#include "nstd/expected.hpp"
 #include "nstd/function.hpp"
 #include "nstd/shared_ptr.hpp"
 
@@ -0,0 +1,27 @@
+#ifndef NSTD_TYPE_TRAITS_HPP
+#define NSTD_TYPE_TRAITS_HPP
+
+#include <memory>
+#include <type_traits>
+
+namespace nstd {
+
+// A type is trivially relocatable when moving an object to a new address and ending the life of
+// the original is equivalent to copying its bytes and forgetting the original, so containers may
+// relocate such elements with memcpy/realloc instead of a move constructor and destructor per
+// element.
+//
+// True for trivially copyable types. Other types opt in by specializing the trait, which is sound
+// as long as no object holds a pointer into itself; most owning handles qualify. A type that is
+// not relocatable must never be marked, or relocation will leave dangling self-references.
+template<typename T> struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template<typename T>
+inline constexpr bool is_trivially_relocatable_v{is_trivially_relocatable<T>::value};
+
+// Stateless, but not trivially copyable because its copy constructor is user-provided.
+template<typename T> struct is_trivially_relocatable<std::allocator<T>> : std::true_type {};
+
+} // namespace nstd
+
+#endif // NSTD_TYPE_TRAITS_HPP
@@ -5,6 +5,8 @@
 #include <type_traits>
 #include <utility>
 
+#include "nstd/type_traits.hpp"
+
 namespace nstd {
 
 /*-----------------------------------------------------------------------------*/
@@ -294,6 +296,9 @@ make_unique(std::size_t size) requires(std::is_array_v<T>&& std::extent_v<T> ==
     using ElementType = std::remove_extent_t<T>;
     return unique_ptr<T>{new ElementType[size]()};
 }
+
+template<typename T, typename Deleter>
+struct is_trivially_relocatable<unique_ptr<T, Deleter>> : is_trivially_relocatable<Deleter> {};
 } // namespace nstd
 
 #endif
\ No newline at end of file
@@ -0,0 +1,625 @@
+#ifndef NSTD_UNROLLED_LIST_HPP
+#define NSTD_UNROLLED_LIST_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "nstd/pool_allocator.hpp"
+
+namespace nstd {
+
+// Default elements per node: about 256 bytes of payload, but at least 4 elements.
+template<typename T> inline constexpr size_t unrolled_list_default_capacity{
+    std::max<size_t>(256 / sizeof(T), 4)};
+
+// Doubly linked list of small arrays.
+//
+// Each node stores up to N elements contiguously, so iteration touches one pointer per N elements
+// and allocation happens once per N elements. Inserting into a full node splits it in half;
+// erasing folds a node that is down to a quarter into a neighbour when both fit into one node.
+// Middle insertion and erasure therefore move at most N elements.
+//
+// Iterators are a node pointer plus an index. Any insertion or erasure invalidates iterators into
+// the nodes it touches (and end()); iterators into other nodes stay valid.
+template<typename T, size_t N = unrolled_list_default_capacity<T>,
+         typename Allocator = pool_allocator<T>>
+class unrolled_list {
+    static_assert(N >= 2, "unrolled_list nodes must hold at least 2 elements");
+
+    struct Node {
+        Node* prev{};
+        Node* next{};
+        size_t count{};
+        alignas(T) std::byte storage[N * sizeof(T)];
+
+        Node() {}
+
+        T* data() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    template<bool Const> class basic_iterator;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    static constexpr size_t node_capacity{N};
+
+    unrolled_list() = default;
+    explicit unrolled_list(const Allocator& alloc) noexcept : _alloc(alloc) {}
+
+    unrolled_list(const unrolled_list& other);
+    unrolled_list(unrolled_list&& other) noexcept;
+    unrolled_list& operator=(const unrolled_list& other);
+    unrolled_list& operator=(unrolled_list&& other) noexcept(
+        node_traits::propagate_on_container_move_assignment::value ||
+        node_traits::is_always_equal::value);
+    ~unrolled_list();
+
+    void push_back(const T& value);
+    void push_back(T&& value);
+    void push_front(const T& value);
+    void push_front(T&& value);
+    template<typename... Args> T& emplace_back(Args&&... args);
+    template<typename... Args> T& emplace_front(Args&&... args);
+    void pop_back();
+    void pop_front();
+
+    iterator insert(const_iterator pos, const T& value);
+    iterator insert(const_iterator pos, T&& value);
+    template<typename... Args> iterator emplace(const_iterator pos, Args&&... args);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+
+    T& front();
+    const T& front() const;
+    T& back();
+    const T& back() const;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+    // Number of nodes currently allocated.
+    size_t node_count() const noexcept;
+    void clear() noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    Allocator get_allocator() const noexcept;
+
+    // Allocators are only exchanged when they propagate on swap, otherwise they must compare equal.
+    friend void swap(unrolled_list& first, unrolled_list& second) noexcept {
+        if constexpr (node_traits::propagate_on_container_swap::value) {
+            std::swap(first._alloc, second._alloc);
+        } else {
+            assert(first._alloc == second._alloc);
+        }
+        std::swap(first._head, second._head);
+        std::swap(first._tail, second._tail);
+        std::swap(first._size, second._size);
+        std::swap(first._nodes, second._nodes);
+    }
+
+private:
+    Node* _create_node();
+    void _destroy_node(Node* node) noexcept;
+    // Allocates an empty node and links it right after `node` (at the front when nullptr).
+    Node* _insert_node_after(Node* node);
+    void _unlink_node(Node* node) noexcept;
+    // Moves the upper half of a full node into a new node right after it.
+    void _split(Node* node);
+    // Moves every element of node->next into node and frees node->next.
+    void _merge_next(Node* node) noexcept;
+
+    Node* _head{};
+    Node* _tail{};
+    size_t _size{};
+    size_t _nodes{};
+    [[no_unique_address]] node_allocator _alloc{};
+};
+
+template<typename T, size_t N, typename Allocator>
+template<bool Const>
+class unrolled_list<T, N, Allocator>::basic_iterator {
+    friend class unrolled_list;
+    template<bool> friend class basic_iterator;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    basic_iterator() = default;
+
+    // iterator converts to const_iterator, not the other way around.
+    template<bool OtherConst>
+        requires(Const && !OtherConst)
+    basic_iterator(const basic_iterator<OtherConst>& other)
+        : _node{other._node}, _index{other._index} {}
+
+    reference operator*() const {
+        return _node->data()[_index];
+    }
+
+    pointer operator->() const {
+        return &_node->data()[_index];
+    }
+
+    basic_iterator& operator++() {
+        if (++_index == _node->count && _node->next) {
+            _node = _node->next;
+            _index = 0;
+        }
+        return *this;
+    }
+
+    basic_iterator operator++(int) {
+        auto temp{*this};
+        ++(*this);
+        return temp;
+    }
+
+    basic_iterator& operator--() {
+        if (_index == 0) {
+            _node = _node->prev;
+            _index = _node->count;
+        }
+        --_index;
+        return *this;
+    }
+
+    basic_iterator operator--(int) {
+        auto temp{*this};
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const basic_iterator& other) const = default;
+
+private:
+    basic_iterator(Node* node, size_t index) : _node{node}, _index{index} {}
+
+    Node* _node{};
+    size_t _index{};
+};
+
+// --- Construction ---
+
+template<typename T, size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::unrolled_list(const unrolled_list& other)
+    : _alloc(node_traits::select_on_container_copy_construction(other._alloc)) {
+    try {
+        for (const auto& value : other) {
+            push_back(value);
+        }
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template<typename T, size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::unrolled_list(unrolled_list&& other) noexcept
+    : _head(other._head), _tail(other._tail), _size(other._size), _nodes(other._nodes),
+      _alloc(std::move(other._alloc)) {
+    other._head = nullptr;
+    other._tail = nullptr;
+    other._size = 0;
+    other._nodes = 0;
+}
+
+template<typename T, size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>&
+unrolled_list<T, N, Allocator>::operator=(const unrolled_list& other) {
+    if (this != &other) {
+        // Our nodes have to go back to the allocator that handed them out.
+        clear();
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+            _alloc = other._alloc;
+        }
+
+        for (const auto& value : other) {
+            push_back(value);
+        }
+    }
+    return *this;
+}
+
+template<typename T, size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>& unrolled_list<T, N, Allocator>::operator=(
+    unrolled_list&& other) noexcept(node_traits::propagate_on_container_move_assignment::value ||
+                                    node_traits::is_always_equal::value) {
+    if (this != &other) {
+        clear();
+
+        if constexpr (!node_traits::propagate_on_container_move_assignment::value &&
+                      !node_traits::is_always_equal::value) {
+            // The nodes belong to an allocator we can not take over, so move element by element.
+            if (_alloc != other._alloc) {
+                for (auto& value : other) {
+                    push_back(std::move(value));
+                }
+                other.clear();
+                return *this;
+            }
+        }
+
+        if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+            _alloc = std::move(other._alloc);
+        }
+
+        _head = std::exchange(other._head, nullptr);
+        _tail = std::exchange(other._tail, nullptr);
+        _size = std::exchange(other._size, 0);
+        _nodes = std::exchange(other._nodes, 0);
+    }
+    return *this;
+}
+
+template<typename T, size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::~unrolled_list() {
+    clear();
+}
+
+// --- Modifiers ---
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::push_front(const T& value) {
+    emplace_front(value);
+}
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::push_front(T&& value) {
+    emplace_front(std::move(value));
+}
+
+template<typename T, size_t N, typename Allocator>
+template<typename... Args>
+T& unrolled_list<T, N, Allocator>::emplace_back(Args&&... args) {
+    // Appending never splits: a full tail just gets a fresh node after it.
+    const bool fresh{!_tail || _tail->count == N};
+    Node* node{fresh ? _insert_node_after(_tail) : _tail};
+
+    try {
+        auto* slot{::new (node->data() + node->count) T(std::forward<Args>(args)...)};
+        ++node->count;
+        ++_size;
+        return *slot;
+    } catch (...) {
+        if (fresh) {
+            _unlink_node(node);
+            _destroy_node(node);
+        }
+        throw;
+    }
+}
+
+template<typename T, size_t N, typename Allocator>
+template<typename... Args>
+T& unrolled_list<T, N, Allocator>::emplace_front(Args&&... args) {
+    if (!_head || _head->count == N) {
+        Node* node{_insert_node_after(nullptr)};
+        try {
+            ::new (node->data()) T(std::forward<Args>(args)...);
+        } catch (...) {
+            _unlink_node(node);
+            _destroy_node(node);
+            throw;
+        }
+        node->count = 1;
+        ++_size;
+        return node->data()[0];
+    }
+
+    return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+template<typename T, size_t N, typename Allocator> void unrolled_list<T, N, Allocator>::pop_back() {
+    if (_tail) {
+        erase(const_iterator(_tail, _tail->count - 1));
+    }
+}
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::pop_front() {
+    if (_head) {
+        erase(begin());
+    }
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::iterator
+unrolled_list<T, N, Allocator>::insert(const_iterator pos, const T& value) {
+    return emplace(pos, value);
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::iterator
+unrolled_list<T, N, Allocator>::insert(const_iterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template<typename T, size_t N, typename Allocator>
+template<typename... Args>
+typename unrolled_list<T, N, Allocator>::iterator
+unrolled_list<T, N, Allocator>::emplace(const_iterator pos, Args&&... args) {
+    Node* node{pos._node};
+    size_t index{pos._index};
+
+    if (!node || (node == _tail && index == node->count)) {
+        emplace_back(std::forward<Args>(args)...);
+        return iterator(_tail, _tail->count - 1);
+    }
+
+    // Built up front: once elements start shifting, a throwing constructor would leave a hole.
+    T value(std::forward<Args>(args)...);
+
+    if (node->count == N) {
+        _split(node);
+        if (index > node->count) {
+            index -= node->count;
+            node = node->next;
+        }
+    }
+
+    T* data{node->data()};
+    if (index == node->count) {
+        ::new (data + index) T(std::move(value));
+    } else {
+        ::new (data + node->count) T(std::move(data[node->count - 1]));
+        std::move_backward(data + index, data + node->count - 1, data + node->count);
+        data[index] = std::move(value);
+    }
+
+    ++node->count;
+    ++_size;
+    return iterator(node, index);
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::iterator
+unrolled_list<T, N, Allocator>::erase(const_iterator pos) {
+    Node* node{pos._node};
+    size_t index{pos._index};
+    assert(node && index < node->count);
+
+    T* data{node->data()};
+    std::move(data + index + 1, data + node->count, data + index);
+    std::destroy_at(data + node->count - 1);
+    --node->count;
+    --_size;
+
+    if (node->count == 0) {
+        Node* next{node->next};
+        _unlink_node(node);
+        _destroy_node(node);
+        return next ? iterator(next, 0) : end();
+    }
+
+    // A node down to a quarter is folded into a neighbour when both fit into one node. Waiting
+    // for a quarter (a split leaves two halves) keeps alternating insert/erase from thrashing.
+    // Only done when moving cannot throw, so erase never fails half way.
+    if constexpr (std::is_nothrow_move_constructible_v<T>) {
+        if (node->count <= N / 4) {
+            if (node->next && node->count + node->next->count <= N) {
+                _merge_next(node);
+            } else if (node->prev && node->prev->count + node->count <= N) {
+                index += node->prev->count;
+                node = node->prev;
+                _merge_next(node);
+            }
+        }
+    }
+
+    if (index == node->count) {
+        return node->next ? iterator(node->next, 0) : end();
+    }
+    return iterator(node, index);
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::iterator
+unrolled_list<T, N, Allocator>::erase(const_iterator first, const_iterator last) {
+    // Count first: merges along the way may move the element `last` points to.
+    size_t count{};
+    for (auto it{first}; it != last; ++it) {
+        ++count;
+    }
+
+    iterator result{first._node, first._index};
+    for (; count > 0; --count) {
+        result = erase(result);
+    }
+    return result;
+}
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::clear() noexcept {
+    while (_head) {
+        Node* next{_head->next};
+        std::destroy_n(_head->data(), _head->count);
+        _destroy_node(_head);
+        _head = next;
+    }
+
+    _tail = nullptr;
+    _size = 0;
+    _nodes = 0;
+}
+
+// --- Access ---
+
+template<typename T, size_t N, typename Allocator> T& unrolled_list<T, N, Allocator>::front() {
+    assert(_head);
+    return _head->data()[0];
+}
+
+template<typename T, size_t N, typename Allocator>
+const T& unrolled_list<T, N, Allocator>::front() const {
+    assert(_head);
+    return _head->data()[0];
+}
+
+template<typename T, size_t N, typename Allocator> T& unrolled_list<T, N, Allocator>::back() {
+    assert(_tail);
+    return _tail->data()[_tail->count - 1];
+}
+
+template<typename T, size_t N, typename Allocator>
+const T& unrolled_list<T, N, Allocator>::back() const {
+    assert(_tail);
+    return _tail->data()[_tail->count - 1];
+}
+
+template<typename T, size_t N, typename Allocator>
+bool unrolled_list<T, N, Allocator>::empty() const noexcept {
+    return _size == 0;
+}
+
+template<typename T, size_t N, typename Allocator>
+size_t unrolled_list<T, N, Allocator>::size() const noexcept {
+    return _size;
+}
+
+template<typename T, size_t N, typename Allocator>
+size_t unrolled_list<T, N, Allocator>::node_count() const noexcept {
+    return _nodes;
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::begin() noexcept {
+    return iterator(_head, 0);
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::end() noexcept {
+    return _tail ? iterator(_tail, _tail->count) : iterator();
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::const_iterator
+unrolled_list<T, N, Allocator>::begin() const noexcept {
+    return const_iterator(_head, 0);
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::const_iterator
+unrolled_list<T, N, Allocator>::end() const noexcept {
+    return _tail ? const_iterator(_tail, _tail->count) : const_iterator();
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::const_iterator
+unrolled_list<T, N, Allocator>::cbegin() const noexcept {
+    return begin();
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::const_iterator
+unrolled_list<T, N, Allocator>::cend() const noexcept {
+    return end();
+}
+
+template<typename T, size_t N, typename Allocator>
+Allocator unrolled_list<T, N, Allocator>::get_allocator() const noexcept {
+    return Allocator(_alloc);
+}
+
+// --- Node management ---
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::Node* unrolled_list<T, N, Allocator>::_create_node() {
+    auto* node{node_traits::allocate(_alloc, 1)};
+    ::new (node) Node();
+    ++_nodes;
+    return node;
+}
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::_destroy_node(Node* node) noexcept {
+    node->~Node();
+    node_traits::deallocate(_alloc, node, 1);
+    --_nodes;
+}
+
+template<typename T, size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::Node*
+unrolled_list<T, N, Allocator>::_insert_node_after(Node* node) {
+    Node* fresh{_create_node()};
+    Node* next{node ? node->next : _head};
+
+    fresh->prev = node;
+    fresh->next = next;
+    (node ? node->next : _head) = fresh;
+    (next ? next->prev : _tail) = fresh;
+    return fresh;
+}
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::_unlink_node(Node* node) noexcept {
+    (node->prev ? node->prev->next : _head) = node->next;
+    (node->next ? node->next->prev : _tail) = node->prev;
+}
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::_split(Node* node) {
+    Node* fresh{_insert_node_after(node)};
+
+    const size_t keep{node->count / 2};
+    const size_t moved{node->count - keep};
+    try {
+        std::uninitialized_move_n(node->data() + keep, moved, fresh->data());
+    } catch (...) {
+        _unlink_node(fresh);
+        _destroy_node(fresh);
+        throw;
+    }
+
+    std::destroy_n(node->data() + keep, moved);
+    node->count = keep;
+    fresh->count = moved;
+}
+
+template<typename T, size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::_merge_next(Node* node) noexcept {
+    Node* next{node->next};
+    std::uninitialized_move_n(next->data(), next->count, node->data() + node->count);
+    std::destroy_n(next->data(), next->count);
+    node->count += next->count;
+
+    _unlink_node(next);
+    _destroy_node(next);
+}
+
+} // namespace nstd
+
+#endif // NSTD_UNROLLED_LIST_HPP
@@ -0,0 +1,674 @@
+#ifndef NSTD_UTF8_HPP
+#define NSTD_UTF8_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "nstd/expected.hpp"
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+
+// The SIMD validators are compiled for AVX2 and SSSE3 regardless of the build flags and picked at
+// run time, so a default x86-64 build still gets them.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define NSTD_SIMD_UTF8 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define NSTD_SIMD_UTF_ASCII 1
+#endif
+
+namespace nstd {
+
+// Position (in code units of the input) of the first code unit that is not part of a valid
+// sequence.
+struct utf_error {
+    size_t position;
+
+    friend bool operator==(const utf_error&, const utf_error&) = default;
+};
+
+namespace detail {
+
+inline bool is_continuation(unsigned char byte) noexcept {
+    return (byte & 0xC0) == 0x80;
+}
+
+// Length of the well-formed UTF-8 sequence starting at `ptr`, or 0 if there is none (overlong
+// forms, surrogates and code points above U+10FFFF are rejected, as RFC 3629 requires).
+inline size_t utf8_sequence_length(const unsigned char* ptr, size_t remaining) noexcept {
+    const auto lead{ptr[0]};
+    if (lead < 0x80) {
+        return 1;
+    }
+    if (lead < 0xC2) {
+        return 0;
+    }
+    if (lead < 0xE0) {
+        return remaining >= 2 && is_continuation(ptr[1]) ? 2 : 0;
+    }
+    if (lead < 0xF0) {
+        if (remaining < 3 || !is_continuation(ptr[1]) || !is_continuation(ptr[2]) ||
+            (lead == 0xE0 && ptr[1] < 0xA0) || (lead == 0xED && ptr[1] >= 0xA0)) {
+            return 0;
+        }
+        return 3;
+    }
+    if (lead < 0xF5) {
+        if (remaining < 4 || !is_continuation(ptr[1]) || !is_continuation(ptr[2]) ||
+            !is_continuation(ptr[3]) || (lead == 0xF0 && ptr[1] < 0x90) ||
+            (lead == 0xF4 && ptr[1] >= 0x90)) {
+            return 0;
+        }
+        return 4;
+    }
+    return 0;
+}
+
+// Offset of the first invalid sequence, or `size` if there is none. Runs of ASCII are skipped
+// sixteen bytes at a time with SSE2, or eight at a time elsewhere.
+inline size_t find_invalid_utf8(const unsigned char* ptr, size_t size) noexcept {
+    size_t pos{};
+    while (pos < size) {
+#if defined(NSTD_SIMD_UTF_ASCII)
+        if (size - pos >= 16) {
+            const auto bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + pos))};
+            if (_mm_movemask_epi8(bytes) == 0) {
+                pos += 16;
+                continue;
+            }
+        }
+#else
+        std::uint64_t word;
+        if (size - pos >= sizeof(word)) {
+            std::memcpy(&word, ptr + pos, sizeof(word));
+            if (!(word & 0x8080808080808080ull)) {
+                pos += sizeof(word);
+                continue;
+            }
+        }
+#endif
+        const auto length{utf8_sequence_length(ptr + pos, size - pos)};
+        if (length == 0) {
+            return pos;
+        }
+        pos += length;
+    }
+    return size;
+}
+
+#if defined(NSTD_SIMD_UTF8)
+// Lookup-table validation (Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per
+// Byte"). Every error in a two-byte window is recognisable from three nibbles: the high and low
+// nibble of the first byte and the high nibble of the second. Each of the three tables maps its
+// nibble to the set of error classes it is compatible with, so AND-ing three shuffles leaves a
+// bit set exactly where an error is. Third and fourth continuation bytes are checked separately
+// against the leads two and three bytes back.
+struct utf8_error_tables {
+    static constexpr unsigned char too_short{1 << 0};  // lead, then no continuation
+    static constexpr unsigned char too_long{1 << 1};   // ASCII, then continuation
+    static constexpr unsigned char overlong_3{1 << 2}; // E0 80..9F
+    static constexpr unsigned char too_large{1 << 3};  // above U+10FFFF
+    static constexpr unsigned char surrogate{1 << 4};  // ED A0..BF
+    static constexpr unsigned char overlong_2{1 << 5}; // C0 / C1
+    static constexpr unsigned char too_large_1000{1 << 6};
+    static constexpr unsigned char overlong_4{1 << 6}; // F0 80..8F
+    static constexpr unsigned char two_conts{1 << 7};  // continuation, then continuation
+    static constexpr unsigned char carry{too_short | too_long | two_conts};
+
+    static constexpr unsigned char first_high[16]{
+        too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+        two_conts, two_conts, two_conts, two_conts,
+        too_short | overlong_2,
+        too_short,
+        too_short | overlong_3 | surrogate,
+        too_short | too_large | too_large_1000 | overlong_4};
+
+    static constexpr unsigned char first_low[16]{
+        carry | overlong_3 | overlong_2 | overlong_4,
+        carry | overlong_2,
+        carry,
+        carry,
+        carry | too_large,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000 | surrogate,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000};
+
+    static constexpr unsigned char second_high[16]{
+        too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_short, too_short, too_short, too_short};
+};
+
+// The validator over the `simd` register operations of the enclosing namespace, and
+// `validate(ptr, size)` running it over a whole input. A function is compiled for the target in
+// effect where it is defined, not where it is instantiated, so this cannot be a template over the
+// instruction set: it is expanded once inside each target region below. For the same reason the
+// constructor is written out; an implicit one would be generated for the default target.
+//
+// In step(), an ASCII block turns a sequence cut off by the end of the previous block into an
+// error. Otherwise `must_continue` has the high bit set where the byte must be the third or fourth
+// of a sequence, which are exactly the places where two continuations in a row are allowed. The
+// zero padding of the tail is ASCII, so it also flags a sequence cut off by the end of the input.
+#define NSTD_UTF8_VALIDATOR                                                                        \
+    struct utf8_validator {                                                                        \
+        using tables = utf8_error_tables;                                                          \
+        using reg = simd::reg;                                                                     \
+                                                                                                   \
+        utf8_validator() noexcept                                                                  \
+            : _error{simd::zero()}, _prev_input{simd::zero()}, _prev_incomplete{simd::zero()} {}   \
+                                                                                                   \
+        void step(reg input) noexcept {                                                            \
+            if (simd::is_ascii(input)) {                                                           \
+                _error = simd::bit_or(_error, _prev_incomplete);                                   \
+                _prev_incomplete = simd::zero();                                                   \
+            } else {                                                                               \
+                const auto prev_1{simd::prev<1>(input, _prev_input)};                              \
+                const auto special{simd::bit_and(                                                  \
+                    simd::bit_and(simd::lookup(tables::first_high, simd::high_nibbles(prev_1)),    \
+                                  simd::lookup(tables::first_low, simd::low_nibbles(prev_1))),     \
+                    simd::lookup(tables::second_high, simd::high_nibbles(input)))};                \
+                                                                                                   \
+                const auto prev_2{simd::prev<2>(input, _prev_input)};                              \
+                const auto prev_3{simd::prev<3>(input, _prev_input)};                              \
+                const auto must_continue{simd::bit_and(                                            \
+                    simd::bit_or(simd::saturating_sub(prev_2, simd::splat(0xE0 - 0x80)),           \
+                                 simd::saturating_sub(prev_3, simd::splat(0xF0 - 0x80))),          \
+                    simd::splat(0x80))};                                                           \
+                                                                                                   \
+                _error = simd::bit_or(_error, simd::bit_xor(must_continue, special));              \
+                _prev_incomplete = simd::saturating_sub(input, simd::incomplete_limit());          \
+            }                                                                                      \
+            _prev_input = input;                                                                   \
+        }                                                                                          \
+                                                                                                   \
+        bool finish() noexcept {                                                                   \
+            return !simd::any(simd::bit_or(_error, _prev_incomplete));                             \
+        }                                                                                          \
+                                                                                                   \
+        reg _error;                                                                                \
+        reg _prev_input;                                                                           \
+        reg _prev_incomplete;                                                                      \
+    };                                                                                             \
+                                                                                                   \
+    inline bool validate(const unsigned char* ptr, size_t size) noexcept {                         \
+        utf8_validator validator;                                                                  \
+        constexpr auto width{simd::width};                                                         \
+        for (; size >= width; ptr += width, size -= width) {                                       \
+            validator.step(simd::load(ptr));                                                       \
+        }                                                                                          \
+        if (size > 0) {                                                                            \
+            unsigned char tail[width]{};                                                           \
+            std::memcpy(tail, ptr, size);                                                          \
+            validator.step(simd::load(tail));                                                      \
+        }                                                                                          \
+        return validator.finish();                                                                 \
+    }
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+namespace utf8_avx2 {
+// Register operations for the validator, over 32-byte blocks.
+struct simd {
+    using reg = __m256i;
+    static constexpr size_t width{32};
+
+    static reg load(const unsigned char* ptr) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    }
+
+    static reg splat(unsigned char byte) noexcept {
+        return _mm256_set1_epi8(static_cast<char>(byte));
+    }
+
+    static reg zero() noexcept {
+        return _mm256_setzero_si256();
+    }
+
+    // table[index] for every byte; the indices must be below 16.
+    static reg lookup(const unsigned char (&table)[16], reg index) noexcept {
+        const auto row{_mm_loadu_si128(reinterpret_cast<const __m128i*>(table))};
+        return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(row), index);
+    }
+
+    static reg high_nibbles(reg bytes) noexcept {
+        return _mm256_and_si256(_mm256_srli_epi16(bytes, 4), splat(0x0F));
+    }
+
+    static reg low_nibbles(reg bytes) noexcept {
+        return _mm256_and_si256(bytes, splat(0x0F));
+    }
+
+    // The block shifted by N bytes towards the end, with the last N bytes of `previous` in front.
+    template<int N> static reg prev(reg input, reg previous) noexcept {
+        return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+    }
+
+    static reg saturating_sub(reg first, reg second) noexcept {
+        return _mm256_subs_epu8(first, second);
+    }
+
+    static reg bit_and(reg first, reg second) noexcept {
+        return _mm256_and_si256(first, second);
+    }
+
+    static reg bit_or(reg first, reg second) noexcept {
+        return _mm256_or_si256(first, second);
+    }
+
+    static reg bit_xor(reg first, reg second) noexcept {
+        return _mm256_xor_si256(first, second);
+    }
+
+    static bool any(reg bytes) noexcept {
+        return !_mm256_testz_si256(bytes, bytes);
+    }
+
+    static bool is_ascii(reg bytes) noexcept {
+        return _mm256_movemask_epi8(bytes) == 0;
+    }
+
+    // Nonzero in the last three bytes when the block ends inside a multi-byte sequence.
+    static reg incomplete_limit() noexcept {
+        return _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1),
+                                static_cast<char>(0xC0 - 1));
+    }
+};
+
+NSTD_UTF8_VALIDATOR
+} // namespace utf8_avx2
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("ssse3"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("ssse3")
+#endif
+namespace utf8_ssse3 {
+// Register operations for the validator, over 16-byte blocks.
+struct simd {
+    using reg = __m128i;
+    static constexpr size_t width{16};
+
+    static reg load(const unsigned char* ptr) noexcept {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    }
+
+    static reg splat(unsigned char byte) noexcept {
+        return _mm_set1_epi8(static_cast<char>(byte));
+    }
+
+    static reg zero() noexcept {
+        return _mm_setzero_si128();
+    }
+
+    static reg lookup(const unsigned char (&table)[16], reg index) noexcept {
+        return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table)), index);
+    }
+
+    static reg high_nibbles(reg bytes) noexcept {
+        return _mm_and_si128(_mm_srli_epi16(bytes, 4), splat(0x0F));
+    }
+
+    static reg low_nibbles(reg bytes) noexcept {
+        return _mm_and_si128(bytes, splat(0x0F));
+    }
+
+    template<int N> static reg prev(reg input, reg previous) noexcept {
+        return _mm_alignr_epi8(input, previous, 16 - N);
+    }
+
+    static reg saturating_sub(reg first, reg second) noexcept {
+        return _mm_subs_epu8(first, second);
+    }
+
+    static reg bit_and(reg first, reg second) noexcept {
+        return _mm_and_si128(first, second);
+    }
+
+    static reg bit_or(reg first, reg second) noexcept {
+        return _mm_or_si128(first, second);
+    }
+
+    static reg bit_xor(reg first, reg second) noexcept {
+        return _mm_xor_si128(first, second);
+    }
+
+    static bool any(reg bytes) noexcept {
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zero())) != 0xFFFF;
+    }
+
+    static bool is_ascii(reg bytes) noexcept {
+        return _mm_movemask_epi8(bytes) == 0;
+    }
+
+    static reg incomplete_limit() noexcept {
+        return _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                             static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1),
+                             static_cast<char>(0xC0 - 1));
+    }
+};
+
+NSTD_UTF8_VALIDATOR
+} // namespace utf8_ssse3
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#undef NSTD_UTF8_VALIDATOR
+#endif
+
+inline bool is_valid_utf8(const unsigned char* ptr, size_t size) noexcept {
+#if defined(__AVX2__)
+    return utf8_avx2::validate(ptr, size);
+#elif defined(NSTD_SIMD_UTF8)
+    // Chosen once, on first use, from what the CPU running the program supports.
+    using kernel = bool (*)(const unsigned char*, size_t) noexcept;
+    static const kernel selected{[]() -> kernel {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return utf8_avx2::validate;
+        }
+        if (__builtin_cpu_supports("ssse3")) {
+            return utf8_ssse3::validate;
+        }
+        return [](const unsigned char* ptr, size_t size) noexcept {
+            return find_invalid_utf8(ptr, size) == size;
+        };
+    }()};
+    return selected(ptr, size);
+#else
+    return find_invalid_utf8(ptr, size) == size;
+#endif
+}
+
+// Number of code points in valid UTF-8: one per byte that is not a continuation. In UTF-16, each
+// four-byte lead adds one more unit for the second half of its surrogate pair.
+template<bool Utf16> size_t utf8_decoded_length(const unsigned char* ptr, size_t size) noexcept {
+    size_t count{};
+    size_t pos{};
+#if defined(NSTD_SIMD_UTF_ASCII)
+    for (; size - pos >= 16; pos += 16) {
+        const auto bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + pos))};
+        // As signed bytes, continuations are -128..-65 and four-byte leads -16..-1.
+        count += static_cast<size_t>(
+            std::popcount(static_cast<unsigned>(_mm_movemask_epi8(
+                _mm_cmpgt_epi8(bytes, _mm_set1_epi8(-65))))));
+        if constexpr (Utf16) {
+            const auto negative{static_cast<unsigned>(_mm_movemask_epi8(bytes))};
+            const auto above{static_cast<unsigned>(
+                _mm_movemask_epi8(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(-17))))};
+            count += static_cast<size_t>(std::popcount(negative & above));
+        }
+    }
+#endif
+    for (; pos < size; ++pos) {
+        count += !is_continuation(ptr[pos]);
+        if constexpr (Utf16) {
+            count += ptr[pos] >= 0xF0;
+        }
+    }
+    return count;
+}
+
+// Decodes valid UTF-8 into `out`, which has room for utf8_decoded_length() units.
+template<typename OutChar>
+void decode_utf8(const unsigned char* ptr, const unsigned char* last, OutChar* out) noexcept {
+    // Block boundary before which the vector path is not retried after failing on non-ASCII.
+    const unsigned char* scalar_until{ptr};
+    while (ptr != last) {
+#if defined(NSTD_SIMD_UTF_ASCII)
+        if (ptr >= scalar_until && last - ptr >= 16) {
+            const auto bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))};
+            if (_mm_movemask_epi8(bytes) == 0) {
+                const auto zero{_mm_setzero_si128()};
+                const auto low{_mm_unpacklo_epi8(bytes, zero)};
+                const auto high{_mm_unpackhi_epi8(bytes, zero)};
+                if constexpr (sizeof(OutChar) == 2) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), low);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), high);
+                } else {
+                    auto* wide{reinterpret_cast<__m128i*>(out)};
+                    _mm_storeu_si128(wide, _mm_unpacklo_epi16(low, zero));
+                    _mm_storeu_si128(wide + 1, _mm_unpackhi_epi16(low, zero));
+                    _mm_storeu_si128(wide + 2, _mm_unpacklo_epi16(high, zero));
+                    _mm_storeu_si128(wide + 3, _mm_unpackhi_epi16(high, zero));
+                }
+                ptr += 16;
+                out += 16;
+                continue;
+            }
+            scalar_until = ptr + 16;
+        }
+#endif
+        const auto lead{ptr[0]};
+        if (lead < 0x80) {
+            *out++ = static_cast<OutChar>(lead);
+            ++ptr;
+        } else if (lead < 0xE0) {
+            *out++ = static_cast<OutChar>((lead & 0x1Fu) << 6 | (ptr[1] & 0x3Fu));
+            ptr += 2;
+        } else if (lead < 0xF0) {
+            *out++ = static_cast<OutChar>((lead & 0x0Fu) << 12 | (ptr[1] & 0x3Fu) << 6 |
+                                          (ptr[2] & 0x3Fu));
+            ptr += 3;
+        } else {
+            const char32_t code_point{(lead & 0x07u) << 18 | (ptr[1] & 0x3Fu) << 12 |
+                                      (ptr[2] & 0x3Fu) << 6 | (ptr[3] & 0x3Fu)};
+            if constexpr (sizeof(OutChar) == 2) {
+                *out++ = static_cast<OutChar>(0xD7C0 + (code_point >> 10));
+                *out++ = static_cast<OutChar>(0xDC00 + (code_point & 0x3FF));
+            } else {
+                *out++ = static_cast<OutChar>(code_point);
+            }
+            ptr += 4;
+        }
+    }
+}
+
+inline size_t utf8_length_of(char32_t code_point) noexcept {
+    return code_point < 0x80 ? 1 : code_point < 0x800 ? 2 : code_point < 0x10000 ? 3 : 4;
+}
+
+inline char* encode_utf8(char32_t code_point, char* out) noexcept {
+    if (code_point < 0x80) {
+        *out++ = static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        *out++ = static_cast<char>(0xC0 | code_point >> 6);
+        *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | code_point >> 12);
+        *out++ = static_cast<char>(0x80 | (code_point >> 6 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xF0 | code_point >> 18);
+        *out++ = static_cast<char>(0x80 | (code_point >> 12 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (code_point >> 6 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    return out;
+}
+
+inline bool is_high_surrogate(char32_t unit) noexcept {
+    return unit >= 0xD800 && unit < 0xDC00;
+}
+
+inline bool is_low_surrogate(char32_t unit) noexcept {
+    return unit >= 0xDC00 && unit < 0xE000;
+}
+
+// Code point of the UTF-16 sequence at `pos`, advancing `pos` past it; `pos` is left in place and
+// false returned for an unpaired surrogate.
+inline bool next_utf16(const char16_t* units, size_t size, size_t& pos,
+                       char32_t& code_point) noexcept {
+    const char32_t unit{units[pos]};
+    if (!is_high_surrogate(unit) && !is_low_surrogate(unit)) {
+        code_point = unit;
+        ++pos;
+        return true;
+    }
+    if (is_high_surrogate(unit) && pos + 1 < size && is_low_surrogate(units[pos + 1])) {
+        code_point = 0x10000 + ((unit - 0xD800) << 10) + (units[pos + 1] - 0xDC00);
+        pos += 2;
+        return true;
+    }
+    return false;
+}
+
+#if defined(NSTD_SIMD_UTF_ASCII)
+// True when the next eight UTF-16 units are all ASCII.
+inline bool is_ascii_utf16_block(const char16_t* units) noexcept {
+    const auto block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(units))};
+    const auto high_bits{_mm_and_si128(block, _mm_set1_epi16(static_cast<short>(0xFF80)))};
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, _mm_setzero_si128())) == 0xFFFF;
+}
+#endif
+
+} // namespace detail
+
+// UTF-8 validation and conversion between UTF-8, UTF-16 and UTF-32.
+//
+// Validation uses the lookup-table algorithm with the AVX2 or SSSE3 kernel the CPU supports,
+// picked at run time with GCC and Clang on x86. Otherwise it falls back to a scalar decoder that
+// skips ASCII sixteen bytes at a time with SSE2 (eight at a time without it).
+// Conversions validate first, then size the output exactly, so each one performs a single
+// allocation (none when the result fits in the string's inline buffer); runs of ASCII are widened
+// or narrowed sixteen bytes at a time on SSE2. Invalid input yields the position of the first
+// invalid code unit instead of a replacement character.
+
+inline bool is_valid_utf8(string_view text) noexcept {
+    return detail::is_valid_utf8(reinterpret_cast<const unsigned char*>(text.data()),
+                                 text.size());
+}
+
+inline expected<void, utf_error> validate_utf8(string_view text) noexcept {
+    if (is_valid_utf8(text)) {
+        return {};
+    }
+    const auto* bytes{reinterpret_cast<const unsigned char*>(text.data())};
+    return unexpected{utf_error{detail::find_invalid_utf8(bytes, text.size())}};
+}
+
+inline expected<u16string, utf_error> utf8_to_utf16(string_view text) {
+    if (auto valid{validate_utf8(text)}; !valid) {
+        return unexpected{valid.error()};
+    }
+    const auto* bytes{reinterpret_cast<const unsigned char*>(text.data())};
+    const auto length{detail::utf8_decoded_length<true>(bytes, text.size())};
+
+    u16string result;
+    result.resize_and_overwrite(length, [&](char16_t* out, size_t count) {
+        detail::decode_utf8(bytes, bytes + text.size(), out);
+        return count;
+    });
+    return result;
+}
+
+inline expected<u32string, utf_error> utf8_to_utf32(string_view text) {
+    if (auto valid{validate_utf8(text)}; !valid) {
+        return unexpected{valid.error()};
+    }
+    const auto* bytes{reinterpret_cast<const unsigned char*>(text.data())};
+    const auto length{detail::utf8_decoded_length<false>(bytes, text.size())};
+
+    u32string result;
+    result.resize_and_overwrite(length, [&](char32_t* out, size_t count) {
+        detail::decode_utf8(bytes, bytes + text.size(), out);
+        return count;
+    });
+    return result;
+}
+
+inline expected<string, utf_error> utf16_to_utf8(u16string_view text) {
+    const auto* units{text.data()};
+    const auto size{text.size()};
+
+    // Validating pass that also measures the output.
+    size_t length{};
+    for (size_t pos{}; pos < size;) {
+#if defined(NSTD_SIMD_UTF_ASCII)
+        if (size - pos >= 8 && detail::is_ascii_utf16_block(units + pos)) {
+            length += 8;
+            pos += 8;
+            continue;
+        }
+#endif
+        char32_t code_point;
+        if (!detail::next_utf16(units, size, pos, code_point)) {
+            return unexpected{utf_error{pos}};
+        }
+        length += detail::utf8_length_of(code_point);
+    }
+
+    string result;
+    result.resize_and_overwrite(length, [&](char* out, size_t count) {
+        for (size_t pos{}; pos < size;) {
+#if defined(NSTD_SIMD_UTF_ASCII)
+            if (size - pos >= 8 && detail::is_ascii_utf16_block(units + pos)) {
+                const auto block{_mm_loadu_si128(reinterpret_cast<const __m128i*>(units + pos))};
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(block, block));
+                out += 8;
+                pos += 8;
+                continue;
+            }
+#endif
+            char32_t code_point;
+            detail::next_utf16(units, size, pos, code_point);
+            out = detail::encode_utf8(code_point, out);
+        }
+        return count;
+    });
+    return result;
+}
+
+inline expected<string, utf_error> utf32_to_utf8(u32string_view text) {
+    size_t length{};
+    for (size_t pos{}; pos < text.size(); ++pos) {
+        const auto code_point{text[pos]};
+        if (code_point > 0x10FFFF || (code_point >= 0xD800 && code_point < 0xE000)) {
+            return unexpected{utf_error{pos}};
+        }
+        length += detail::utf8_length_of(code_point);
+    }
+
+    string result;
+    result.resize_and_overwrite(length, [&](char* out, size_t count) {
+        for (const auto code_point : text) {
+            out = detail::encode_utf8(code_point, out);
+        }
+        return count;
+    });
+    return result;
+}
+
+} // namespace nstd
+
+#endif // NSTD_UTF8_HPP
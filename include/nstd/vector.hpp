@@ -1,19 +1,64 @@
 ﻿#ifndef NSTD_VECTOR_HPP
 #define NSTD_VECTOR_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdlib>
 #include <cstring>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <new>
+#include <ranges>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
+#include "nstd/type_traits.hpp"
+
 namespace nstd {
-template<typename T> class vector {
+
+namespace detail {
+
+// Allocators that construct or destroy elements themselves have to see every element move.
+template<typename Allocator, typename T>
+concept constructs_elements = requires(Allocator& alloc, T* ptr) {
+    alloc.construct(ptr, std::move(*ptr));
+} || requires(Allocator& alloc, T* ptr) { alloc.destroy(ptr); };
+
+// Elements are relocated by copying their bytes rather than by move construction + destruction.
+template<typename T, typename Allocator>
+inline constexpr bool relocates_bitwise{is_trivially_relocatable_v<T> &&
+                                        !constructs_elements<Allocator, T>};
+
+// With the default allocator such buffers come from malloc so that growing one is a realloc: the
+// block is extended in place when possible, and a large (mmap-backed) one has its pages remapped
+// by the kernel instead of copied.
+template<typename T, typename Allocator>
+inline constexpr bool grows_with_realloc{relocates_bitwise<T, Allocator> &&
+                                         std::is_same_v<Allocator, std::allocator<T>> &&
+                                         alignof(T) <= alignof(std::max_align_t)};
+
+// Iterators whose range can be measured before it is read, so that it can be stored with a single
+// allocation. The iterator category is checked as well, because move_iterator only models
+// std::input_iterator even over a random access iterator.
+template<typename Iter>
+concept multipass_iterator = std::forward_iterator<Iter> || requires {
+    requires std::derived_from<typename std::iterator_traits<Iter>::iterator_category,
+                               std::forward_iterator_tag>;
+};
+
+} // namespace detail
+
+template<typename T, typename Allocator = std::allocator<T>> class vector {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
 public:
     using value_type = T;
+    using allocator_type = Allocator;
     using iterator = T*;
     using const_iterator = const T*;
     using reference = T&;
@@ -24,14 +69,18 @@ public:
     using const_pointer = const T*;
 
     // --- Constructors & Destructor ---
-    vector() noexcept;
-    explicit vector(size_type count);
-    vector(std::initializer_list<T> list);
-    vector(size_type count, const_reference value);
+    vector() noexcept(noexcept(Allocator()));
+    explicit vector(const Allocator& alloc) noexcept;
+    explicit vector(size_type count, const Allocator& alloc = Allocator());
+    vector(std::initializer_list<T> list, const Allocator& alloc = Allocator());
+    vector(size_type count, const_reference value, const Allocator& alloc = Allocator());
     vector(const vector& other);
+    vector(const vector& other, const Allocator& alloc);
     vector(vector&& other) noexcept;
+    vector(vector&& other, const Allocator& alloc);
 
-    template<typename Iter> vector(Iter first, Iter last);
+    template<std::input_iterator Iter>
+    vector(Iter first, Iter last, const Allocator& alloc = Allocator());
 
     ~vector();
 
@@ -41,9 +90,13 @@ public:
     // vector& operator=(vector other);
 
     vector& operator=(const vector& other);
-    vector& operator=(vector&& other) noexcept;
+    vector& operator=(vector&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_traits::is_always_equal::value);
     vector& operator=(std::initializer_list<T> ilist);
 
+    allocator_type get_allocator() const noexcept;
+
     // --- Iterators ---
     iterator begin() noexcept;
     const_iterator begin() const noexcept;
@@ -86,10 +139,19 @@ public:
     iterator insert(const_iterator pos, const_reference value);
     iterator insert(const_iterator pos, T&& value);
     iterator insert(const_iterator pos, size_type count, const_reference value);
+    iterator insert(const_iterator pos, std::initializer_list<T> ilist);
+
+    // Ranges inserted, appended or assigned must not overlap the vector. Unless the source can
+    // only be read once, its length is taken up front, so the vector reallocates at most once.
+    template<std::input_iterator Iter> iterator insert(const_iterator pos, Iter first, Iter last);
+    template<std::ranges::input_range Range>
+    iterator insert_range(const_iterator pos, Range&& range);
+    template<std::ranges::input_range Range> void append_range(Range&& range);
 
     void assign(size_type count, const_reference value);
     void assign(std::initializer_list<T> ilist);
     template<std::input_iterator InputIt> void assign(InputIt first, InputIt last);
+    template<std::ranges::input_range Range> void assign_range(Range&& range);
 
     iterator erase(const_iterator pos);
 
@@ -99,7 +161,13 @@ public:
     void clear() noexcept;
 
     // --- Friends ---
+    // Allocators are only exchanged when they propagate on swap, otherwise they must compare equal.
     friend void swap(vector& a, vector& b) noexcept {
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+            std::swap(a._alloc, b._alloc);
+        } else {
+            assert(a._alloc == b._alloc);
+        }
         std::swap(a._data, b._data);
         std::swap(a._capacity, b._capacity);
         std::swap(a._length, b._length);
@@ -140,11 +208,22 @@ public:
 private:
     // --- Helpers ---
     void _reallocate(size_type size);
+    size_type _grown_capacity(size_type required) const;
+    template<typename Iter> void _construct_n(pointer dest, Iter first, size_type count);
+    template<typename Iter> iterator _insert_n(size_type index, Iter first, size_type count);
+    template<typename Iter, typename Sentinel>
+    iterator _insert_each(size_type index, Iter first, Sentinel last);
+    template<typename Iter> void _assign_n(Iter first, size_type count);
+    pointer _allocate(size_type count);
+    void _deallocate(pointer ptr, size_type count) noexcept;
+    void _destroy(pointer first, pointer last) noexcept;
+    void _release() noexcept;
 
     // --- Member Data ---
     size_type _capacity{};
     size_type _length{};
     T* _data{};
+    [[no_unique_address]] Allocator _alloc{};
 };
 
 // ==========================================
@@ -153,9 +232,15 @@ private:
 
 // --- Constructors & Destructor ---
 
-template<typename T> vector<T>::vector() noexcept : _capacity{0}, _length{0}, _data{nullptr} {}
+template<typename T, typename Allocator>
+vector<T, Allocator>::vector() noexcept(noexcept(Allocator())) : vector(Allocator()) {}
+
+template<typename T, typename Allocator>
+vector<T, Allocator>::vector(const Allocator& alloc) noexcept
+    : _capacity{0}, _length{0}, _data{nullptr}, _alloc{alloc} {}
 
-template<typename T> vector<T>::vector(size_type count) : vector() {
+template<typename T, typename Allocator>
+vector<T, Allocator>::vector(size_type count, const Allocator& alloc) : vector(alloc) {
     reserve(count);
 
     // Technically this try/catch is not needed here.
@@ -164,12 +249,12 @@ template<typename T> vector<T>::vector(size_type count) : vector() {
     // up mempory in case of exception.
     try {
         for (size_type i{}; i < count; ++i) {
-            std::construct_at(_data + i);
+            alloc_traits::construct(_alloc, _data + i);
             ++_length;
         }
     } catch (...) {
         clear();
-        ::operator delete(_data);
+        _release();
         throw;
     }
 
@@ -182,7 +267,9 @@ template<typename T> vector<T>::vector(size_type count) : vector() {
     // resize(count);
 }
 
-template<typename T> vector<T>::vector(const std::initializer_list<T> list) : vector() {
+template<typename T, typename Allocator>
+vector<T, Allocator>::vector(const std::initializer_list<T> list, const Allocator& alloc)
+    : vector(alloc) {
     if (list.size() == 0) {
         return;
     }
@@ -210,7 +297,7 @@ template<typename T> vector<T>::vector(const std::initializer_list<T> list) : ve
     reserve(list.size());
 
     for (const auto& item : list) {
-        std::construct_at(_data + _length, item);
+        alloc_traits::construct(_alloc, _data + _length, item);
         ++_length;
     }
 
@@ -219,21 +306,28 @@ template<typename T> vector<T>::vector(const std::initializer_list<T> list) : ve
     // assign(list);
 }
 
-template<typename T> vector<T>::vector(size_type count, const_reference value) : vector() {
+template<typename T, typename Allocator>
+vector<T, Allocator>::vector(size_type count, const_reference value, const Allocator& alloc)
+    : vector(alloc) {
     reserve(count);
 
     for (size_type i{}; i < count; ++i) {
-        std::construct_at(_data + _length, value);
+        alloc_traits::construct(_alloc, _data + _length, value);
         ++_length;
     }
 }
 
-template<typename T> vector<T>::vector(const vector& other) : vector() {
+template<typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector& other)
+    : vector(other, alloc_traits::select_on_container_copy_construction(other._alloc)) {}
+
+template<typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector& other, const Allocator& alloc) : vector(alloc) {
     if (other._length == 0) {
         return;
     }
 
-    _data = static_cast<T*>(::operator new(sizeof(T) * other._capacity));
+    _data = _allocate(other._capacity);
     _capacity = other._capacity;
 
     try {
@@ -247,40 +341,54 @@ template<typename T> vector<T>::vector(const vector& other) : vector() {
         // }
 
         for (const auto& elem : other) {
-            std::construct_at(_data + _length, elem);
+            alloc_traits::construct(_alloc, _data + _length, elem);
             ++_length;
         }
     } catch (...) {
-        std::destroy(_data, _data + _length);
-        ::operator delete(_data);
+        _destroy(_data, _data + _length);
+        _length = 0;
+        _release();
         throw;
     }
 }
 
-template<typename T>
-vector<T>::vector(vector&& other) noexcept
-    : _data{other._data}, _capacity{other._capacity}, _length{other._length} {
+template<typename T, typename Allocator>
+vector<T, Allocator>::vector(vector&& other) noexcept
+    : _capacity{other._capacity}, _length{other._length}, _data{other._data},
+      _alloc{std::move(other._alloc)} {
     other._data = nullptr;
     other._capacity = 0;
     other._length = 0;
 }
 
-template<typename T>
-template<typename Iter>
-inline vector<T>::vector(Iter first, Iter last) : vector() {
-    auto size{std::distance(first, last)};
-    if (size > 0) {
-        reserve(size);
-        for (; first != last; ++first) {
-            std::construct_at(_data + _length, *first);
-            ++_length;
-        }
+template<typename T, typename Allocator>
+vector<T, Allocator>::vector(vector&& other, const Allocator& alloc) : vector(alloc) {
+    if (_alloc == other._alloc) {
+        swap(*this, other);
+        return;
+    }
+
+    // Memory from a different allocator can not be adopted, move element by element instead.
+    reserve(other._length);
+    for (auto& elem : other) {
+        alloc_traits::construct(_alloc, _data + _length, std::move(elem));
+        ++_length;
+    }
+}
+
+template<typename T, typename Allocator>
+template<std::input_iterator Iter>
+inline vector<T, Allocator>::vector(Iter first, Iter last, const Allocator& alloc) : vector(alloc) {
+    if constexpr (detail::multipass_iterator<Iter>) {
+        _assign_n(first, static_cast<size_type>(std::distance(first, last)));
+    } else {
+        _insert_each(0, first, last);
     }
 }
 
-template<typename T> vector<T>::~vector() {
-    std::destroy(_data, _data + _length);
-    ::operator delete(_data);
+template<typename T, typename Allocator> vector<T, Allocator>::~vector() {
+    _destroy(_data, _data + _length);
+    _deallocate(_data, _capacity);
 }
 
 // --- Assignment ---
@@ -294,33 +402,41 @@ template<typename T> vector<T>::~vector() {
 //	return *this;
 // }
 
-template<typename T> vector<T>& vector<T>::operator=(const vector& other) {
+template<typename T, typename Allocator>
+vector<T, Allocator>& vector<T, Allocator>::operator=(const vector& other) {
     if (this != &other) {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+            // Our buffer has to go back to the allocator that handed it out.
+            if (_alloc != other._alloc) {
+                clear();
+                _release();
+            }
+            _alloc = other._alloc;
+        }
+
         if (other._length == 0) {
             clear();
-            ::operator delete(_data);
-            _data = nullptr;
-            _capacity = 0;
+            _release();
             return *this;
         }
 
-        auto* new_mem{static_cast<pointer>(::operator new(sizeof(value_type) * other._length))};
+        auto* new_mem{_allocate(other._length)};
 
         auto thisIt{new_mem};
 
         try {
             for (auto otherIt{other.cbegin()}; otherIt != other.cend(); ++otherIt, ++thisIt) {
-                std::construct_at(thisIt, *otherIt);
+                alloc_traits::construct(_alloc, thisIt, *otherIt);
             }
         } catch (...) {
-            std::destroy(new_mem, thisIt);
-            ::operator delete(new_mem);
+            _destroy(new_mem, thisIt);
+            _deallocate(new_mem, other._length);
             throw;
         }
 
         clear();
 
-        ::operator delete(_data);
+        _deallocate(_data, _capacity);
         _data = new_mem;
         _capacity = other._length;
         _length = other._length;
@@ -329,10 +445,27 @@ template<typename T> vector<T>& vector<T>::operator=(const vector& other) {
     return *this;
 }
 
-template<typename T> vector<T>& vector<T>::operator=(vector&& other) noexcept {
+template<typename T, typename Allocator>
+vector<T, Allocator>& vector<T, Allocator>::operator=(vector&& other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
     if (this != &other) {
+        if constexpr (!alloc_traits::propagate_on_container_move_assignment::value &&
+                      !alloc_traits::is_always_equal::value) {
+            // The buffer belongs to an allocator we can not take over, so move element by element.
+            if (_alloc != other._alloc) {
+                assign(std::make_move_iterator(other.begin()),
+                       std::make_move_iterator(other.end()));
+                return *this;
+            }
+        }
+
         clear();
-        ::operator delete(_data);
+        _release();
+
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+            _alloc = std::move(other._alloc);
+        }
 
         _data = other._data;
         _length = other._length;
@@ -345,31 +478,30 @@ template<typename T> vector<T>& vector<T>::operator=(vector&& other) noexcept {
     return *this;
 }
 
-template<typename T> vector<T>& vector<T>::operator=(std::initializer_list<T> ilist) {
+template<typename T, typename Allocator>
+vector<T, Allocator>& vector<T, Allocator>::operator=(std::initializer_list<T> ilist) {
     if (ilist.size() == 0) {
         clear();
-        ::operator delete(_data);
-        _capacity = 0;
-        _data = nullptr;
+        _release();
         return *this;
     }
 
-    auto* new_mem{static_cast<pointer>(::operator new(sizeof(value_type) * ilist.size()))};
+    auto* new_mem{_allocate(ilist.size())};
     size_type i{};
 
     try {
         for (const auto& item : ilist) {
-            std::construct_at(new_mem + i, item);
+            alloc_traits::construct(_alloc, new_mem + i, item);
             ++i;
         }
     } catch (...) {
-        std::destroy(new_mem, new_mem + i);
-        operator delete(new_mem);
+        _destroy(new_mem, new_mem + i);
+        _deallocate(new_mem, ilist.size());
         throw;
     }
 
     clear();
-    ::operator delete(_data);
+    _deallocate(_data, _capacity);
 
     _data = new_mem;
     _capacity = ilist.size();
@@ -378,51 +510,66 @@ template<typename T> vector<T>& vector<T>::operator=(std::initializer_list<T> il
     return *this;
 }
 
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::allocator_type vector<T, Allocator>::get_allocator() const noexcept {
+    return _alloc;
+}
+
 // --- Iterators ---
 
-template<typename T> typename vector<T>::iterator vector<T>::begin() noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::begin() noexcept {
     return _data;
 }
 
-template<typename T> typename vector<T>::const_iterator vector<T>::begin() const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator vector<T, Allocator>::begin() const noexcept {
     return _data;
 }
 
-template<typename T> typename vector<T>::const_iterator vector<T>::cbegin() const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator vector<T, Allocator>::cbegin() const noexcept {
     return _data;
 }
 
-template<typename T> typename vector<T>::iterator vector<T>::end() noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::end() noexcept {
     return _data + _length;
 }
 
-template<typename T> typename vector<T>::const_iterator vector<T>::end() const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator vector<T, Allocator>::end() const noexcept {
     return _data + _length;
 }
 
-template<typename T> typename vector<T>::const_iterator vector<T>::cend() const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator vector<T, Allocator>::cend() const noexcept {
     return _data + _length;
 }
 
 // --- Capacity ---
 
-template<typename T> typename vector<T>::size_type vector<T>::size() const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::size() const noexcept {
     return _length;
 }
 
-template<typename T> typename vector<T>::size_type vector<T>::get_capacity() const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::get_capacity() const noexcept {
     return _capacity;
 }
 
-template<typename T> typename vector<T>::size_type vector<T>::max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(T);
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::max_size() const noexcept {
+    return std::min(std::numeric_limits<size_type>::max() / sizeof(T),
+                    static_cast<size_type>(alloc_traits::max_size(_alloc)));
 }
 
-template<typename T> bool vector<T>::is_empty() const noexcept {
+template<typename T, typename Allocator> bool vector<T, Allocator>::is_empty() const noexcept {
     return _length == 0;
 }
 
-template<typename T> void vector<T>::reserve(size_type new_cap) {
+template<typename T, typename Allocator> void vector<T, Allocator>::reserve(size_type new_cap) {
     if (new_cap <= _capacity) {
         return;
     }
@@ -430,13 +577,14 @@ template<typename T> void vector<T>::reserve(size_type new_cap) {
     _reallocate(new_cap);
 }
 
-template<typename T> void vector<T>::resize(size_type new_length, const_reference value) {
+template<typename T, typename Allocator>
+void vector<T, Allocator>::resize(size_type new_length, const_reference value) {
     if (new_length == _length) {
         return;
     }
 
     if (new_length < _length) {
-        std::destroy(_data + new_length, _data + _length);
+        _destroy(_data + new_length, _data + _length);
         _length = new_length;
         return;
     }
@@ -446,18 +594,18 @@ template<typename T> void vector<T>::resize(size_type new_length, const_referenc
     }
 
     for (size_type i{_length}; i < new_length; ++i) {
-        std::construct_at(_data + i, value);
+        alloc_traits::construct(_alloc, _data + i, value);
         ++_length;
     }
 }
 
-template<typename T> void vector<T>::resize(size_type new_length) {
+template<typename T, typename Allocator> void vector<T, Allocator>::resize(size_type new_length) {
     if (new_length == _length) {
         return;
     }
 
     if (new_length < _length) {
-        std::destroy(_data + new_length, _data + _length);
+        _destroy(_data + new_length, _data + _length);
         _length = new_length;
         return;
     }
@@ -470,16 +618,14 @@ template<typename T> void vector<T>::resize(size_type new_length) {
         // NO ARGUMENTS passed here.
         // This invokes the Default Constructor directly in-place.
         // It does NOT invoke the Copy Constructor.
-        std::construct_at(_data + i);
+        alloc_traits::construct(_alloc, _data + i);
         ++_length;
     }
 }
 
-template<typename T> void vector<T>::shrink_to_fit() {
+template<typename T, typename Allocator> void vector<T, Allocator>::shrink_to_fit() {
     if (_length == 0) {
-        ::operator delete(_data);
-        _data = nullptr;
-        _capacity = 0;
+        _release();
         return;
     }
 
@@ -490,96 +636,108 @@ template<typename T> void vector<T>::shrink_to_fit() {
 
 // --- Element Access ---
 
-template<typename T>
-typename vector<T>::reference vector<T>::operator[](const size_type index) noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::reference
+vector<T, Allocator>::operator[](const size_type index) noexcept {
     assert(index < _length);
     return _data[index];
 }
 
-template<typename T>
-typename vector<T>::const_reference vector<T>::operator[](const size_type index) const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference
+vector<T, Allocator>::operator[](const size_type index) const noexcept {
     assert(index < _length);
     return _data[index];
 }
 
-template<typename T> typename vector<T>::reference vector<T>::at(size_type index) {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::at(size_type index) {
     if (index >= _length)
         throw std::out_of_range("vector index out of range");
     return _data[index];
 }
 
-template<typename T> typename vector<T>::const_reference vector<T>::at(size_type index) const {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::at(size_type index) const {
     if (index >= _length)
         throw std::out_of_range("vector index out of range");
     return _data[index];
 }
 
-template<typename T> typename vector<T>::reference vector<T>::front() noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::front() noexcept {
     assert(_length >= 1);
     return _data[0];
 }
 
-template<typename T> typename vector<T>::const_reference vector<T>::front() const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::front() const noexcept {
     assert(_length >= 1);
     return _data[0];
 }
 
-template<typename T> typename vector<T>::reference vector<T>::back() noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::back() noexcept {
     assert(_length >= 1);
     return _data[_length - 1];
 }
 
-template<typename T> typename vector<T>::const_reference vector<T>::back() const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::back() const noexcept {
     assert(_length >= 1);
     return _data[_length - 1];
 }
 
-template<typename T> typename vector<T>::iterator vector<T>::data() noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::data() noexcept {
     return _data;
 }
 
-template<typename T> typename vector<T>::const_iterator vector<T>::data() const noexcept {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator vector<T, Allocator>::data() const noexcept {
     return _data;
 }
 
 // --- Modifiers ---
 
-template<typename T> void vector<T>::push_back(const_reference element) {
+template<typename T, typename Allocator>
+void vector<T, Allocator>::push_back(const_reference element) {
     if (_length == _capacity) {
         if (&element >= _data && &element < _data + _length) {
             auto index{&element - _data};
             reserve(_capacity ? _capacity * 2 : 1);
-            std::construct_at(_data + _length, _data[index]);
+            alloc_traits::construct(_alloc, _data + _length, _data[index]);
         } else {
             reserve(_capacity ? _capacity * 2 : 1);
-            std::construct_at(_data + _length, element);
+            alloc_traits::construct(_alloc, _data + _length, element);
         }
     } else {
-        std::construct_at(_data + _length, element);
+        alloc_traits::construct(_alloc, _data + _length, element);
     }
 
     ++_length;
 }
 
-template<typename T> void vector<T>::push_back(T&& element) {
+template<typename T, typename Allocator> void vector<T, Allocator>::push_back(T&& element) {
     if (_length == _capacity) {
         if (&element >= _data && &element < _data + _length) {
             auto index{&element - _data};
             reserve(_capacity ? _capacity * 2 : 1);
-            std::construct_at(_data + _length, std::move(_data[index]));
+            alloc_traits::construct(_alloc, _data + _length, std::move(_data[index]));
         } else {
             reserve(_capacity ? _capacity * 2 : 1);
-            std::construct_at(_data + _length, std::move(element));
+            alloc_traits::construct(_alloc, _data + _length, std::move(element));
         }
     } else {
-        std::construct_at(_data + _length, std::move(element));
+        alloc_traits::construct(_alloc, _data + _length, std::move(element));
     }
 
     ++_length;
 }
 
-template<typename T>
-typename vector<T>::iterator vector<T>::insert(const_iterator pos, const_reference value) {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::iterator
+vector<T, Allocator>::insert(const_iterator pos, const_reference value) {
     if (pos < cbegin() || pos > cend()) {
         throw std::out_of_range("Iterator out of bounds");
     }
@@ -603,7 +761,7 @@ typename vector<T>::iterator vector<T>::insert(const_iterator pos, const_referen
     // Last elem needs special handling because at _data + _length,
     // it is raw memory we can not assign there because there is no object to call assignment
     // operator.
-    std::construct_at(_data + _length, std::move(_data[_length - 1]));
+    alloc_traits::construct(_alloc, _data + _length, std::move(_data[_length - 1]));
     for (size_type i = _length - 1; i > index; --i) {
         _data[i] = std::move(_data[i - 1]);
     }
@@ -614,7 +772,9 @@ typename vector<T>::iterator vector<T>::insert(const_iterator pos, const_referen
     return begin() + index;
 }
 
-template<typename T> typename vector<T>::iterator vector<T>::insert(const_iterator pos, T&& value) {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::iterator
+vector<T, Allocator>::insert(const_iterator pos, T&& value) {
     if (pos < cbegin() || pos > cend()) {
         throw std::out_of_range("Iterator out of bounds");
     }
@@ -635,7 +795,7 @@ template<typename T> typename vector<T>::iterator vector<T>::insert(const_iterat
         reserve(_capacity ? _capacity * 2 : 1);
     }
 
-    std::construct_at(_data + _length, std::move(_data[_length - 1]));
+    alloc_traits::construct(_alloc, _data + _length, std::move(_data[_length - 1]));
     for (size_type i = _length - 1; i > index; --i) {
         _data[i] = std::move(_data[i - 1]);
     }
@@ -646,75 +806,9 @@ template<typename T> typename vector<T>::iterator vector<T>::insert(const_iterat
     return begin() + index;
 }
 
-// FOR LEARNING PURPOSE- AVOID RAW LOOPS OTHERWISE
-//
-// template<typename T>
-// typename vector<T>::iterator vector<T>::insert(const_iterator pos, size_type count,
-// const_reference value) { 	if (pos < cbegin() || pos > cend()) { 		throw std::out_of_range("Iterator
-//out of bounds");
-//	}
-
-//	if (&value >= _data && &value < _data + _length) {
-//		value_type temp = value;
-//		return insert(pos, count, temp);
-//	}
-
-//	if (count == 0) {
-//		return begin() + (pos - cbegin());
-//	}
-
-//	if (pos == cend()) {
-//		for (size_type i{}; i < count; ++i) {
-//			push_back(value);
-//		}
-//		return end() - count;
-//	}
-
-//	// We want to store index in case reallocation happen in reserve.
-//	auto insert_index{ pos - cbegin() };
-
-//	if (_length + count > _capacity) {
-//		reserve(std::max(_length + count, _capacity * 2));
-//	}
-
-//	auto insert_pos{ _data + insert_index };
-
-//	auto old_end{ _data + _length - 1 };
-//	auto new_end{ _data + _length + count - 1 };
-
-//	auto des{ new_end };
-//	auto src{ old_end };
-
-//	// Do all the shifting of existing elements.
-//	while (src >= insert_pos) {
-//		if (des > old_end) {
-//			std::construct_at(des, std::move(*src));
-//		}
-//		else {
-//			*des = std::move(*src);
-//		}
-//		--des;
-//		--src;
-//	}
-
-//	// Now only value needs to be filled.
-//	while (des >= insert_pos) {
-//		if (des > old_end) {
-//			std::construct_at(des, value);
-//		}
-//		else {
-//			*des = value;
-//		}
-//		--des;
-//	}
-
-//	_length += count;
-
-//	return begin() + insert_index;
-//}
-
-template<typename T>
-typename vector<T>::iterator vector<T>::insert(const_iterator pos, size_type count,
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::iterator
+vector<T, Allocator>::insert(const_iterator pos, size_type count,
                                                const_reference value) {
     if (pos < cbegin() || pos > cend()) {
         throw std::out_of_range("Iterator out of bounds");
@@ -781,12 +875,56 @@ typename vector<T>::iterator vector<T>::insert(const_iterator pos, size_type cou
     return begin() + insert_index;
 }
 
-template<typename T> void vector<T>::assign(size_type count, const_reference value) {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::iterator
+vector<T, Allocator>::insert(const_iterator pos, std::initializer_list<T> ilist) {
+    return insert(pos, ilist.begin(), ilist.end());
+}
+
+template<typename T, typename Allocator>
+template<std::input_iterator Iter>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(const_iterator pos, Iter first,
+                                                                     Iter last) {
+    if (pos < cbegin() || pos > cend()) {
+        throw std::out_of_range("Iterator out of bounds");
+    }
+
+    const auto index{static_cast<size_type>(pos - cbegin())};
+    if constexpr (detail::multipass_iterator<Iter>) {
+        return _insert_n(index, first, static_cast<size_type>(std::distance(first, last)));
+    } else {
+        return _insert_each(index, first, last);
+    }
+}
+
+template<typename T, typename Allocator>
+template<std::ranges::input_range Range>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert_range(const_iterator pos,
+                                                                           Range&& range) {
+    if (pos < cbegin() || pos > cend()) {
+        throw std::out_of_range("Iterator out of bounds");
+    }
+
+    const auto index{static_cast<size_type>(pos - cbegin())};
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>) {
+        const auto count{static_cast<size_type>(std::ranges::distance(range))};
+        return _insert_n(index, std::ranges::begin(range), count);
+    } else {
+        return _insert_each(index, std::ranges::begin(range), std::ranges::end(range));
+    }
+}
+
+template<typename T, typename Allocator>
+template<std::ranges::input_range Range>
+void vector<T, Allocator>::append_range(Range&& range) {
+    insert_range(cend(), std::forward<Range>(range));
+}
+
+template<typename T, typename Allocator>
+void vector<T, Allocator>::assign(size_type count, const_reference value) {
     if (count == 0) {
         clear();
-        ::operator delete(_data);
-        _capacity = 0;
-        _data = nullptr;
+        _release();
         return;
     }
 
@@ -797,22 +935,22 @@ template<typename T> void vector<T>::assign(size_type count, const_reference val
     }
 
     if (count > _capacity) {
-        auto* new_mem{static_cast<pointer>(::operator new(sizeof(value_type) * count))};
+        auto* new_mem{_allocate(count)};
 
         size_type i{};
 
         try {
             for (; i < count; ++i) {
-                std::construct_at(new_mem + i, value);
+                alloc_traits::construct(_alloc, new_mem + i, value);
             }
         } catch (...) {
-            std::destroy(new_mem, new_mem + i);
-            ::operator delete(new_mem);
+            _destroy(new_mem, new_mem + i);
+            _deallocate(new_mem, count);
             throw;
         }
 
         clear();
-        ::operator delete(_data);
+        _deallocate(_data, _capacity);
 
         _data = new_mem;
         _capacity = count;
@@ -825,62 +963,41 @@ template<typename T> void vector<T>::assign(size_type count, const_reference val
         _length = count;
     } else {
         std::fill_n(_data, count, value);
-        std::destroy_n(_data + count, _length - count);
+        _destroy(_data + count, _data + count + (_length - count));
         _length = count;
     }
 }
 
-template<typename T> void vector<T>::assign(std::initializer_list<T> ilist) {
+template<typename T, typename Allocator>
+void vector<T, Allocator>::assign(std::initializer_list<T> ilist) {
     // We already have assignment operator taking init list.
     *this = ilist;
 };
 
-template<typename T>
+template<typename T, typename Allocator>
 template<std::input_iterator Iter>
-void vector<T>::assign(Iter first, Iter last) {
-    auto count{static_cast<size_type>(std::distance(first, last))};
-
-    if (count == 0) {
+void vector<T, Allocator>::assign(Iter first, Iter last) {
+    if constexpr (detail::multipass_iterator<Iter>) {
+        _assign_n(first, static_cast<size_type>(std::distance(first, last)));
+    } else {
         clear();
-        ::operator delete(_data);
-        _capacity = 0;
-        _data = nullptr;
-        return;
+        _insert_each(0, first, last);
     }
+}
 
-    if (count > _capacity) {
-        auto* new_mem{static_cast<pointer>(::operator new(sizeof(value_type) * count))};
-
-        size_type i = 0;
-        auto current{first};
-        try {
-            for (; i < count; ++i, ++current) {
-                std::construct_at(new_mem + i, *current);
-            }
-        } catch (...) {
-            std::destroy(new_mem, new_mem + i);
-            ::operator delete(new_mem);
-            throw;
-        }
-        clear();
-        ::operator delete(_data);
-        _data = new_mem;
-        _capacity = count;
-        _length = count;
-    } else if (count > _length) {
-        auto mid = first;
-        std::advance(mid, _length);
-        std::copy(first, mid, _data);
-        std::uninitialized_copy(mid, last, _data + _length);
-        _length = count;
+template<typename T, typename Allocator>
+template<std::ranges::input_range Range>
+void vector<T, Allocator>::assign_range(Range&& range) {
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>) {
+        _assign_n(std::ranges::begin(range), static_cast<size_type>(std::ranges::distance(range)));
     } else {
-        std::copy(first, last, _data);
-        std::destroy_n(_data + count, _length - count);
-        _length = count;
+        clear();
+        _insert_each(0, std::ranges::begin(range), std::ranges::end(range));
     }
 }
 
-template<typename T> typename vector<T>::iterator vector<T>::erase(const_iterator pos) {
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(const_iterator pos) {
     if (pos < cbegin() || pos >= cend()) {
         throw std::out_of_range{"Iterator is out of bounds"};
     }
@@ -891,57 +1008,310 @@ template<typename T> typename vector<T>::iterator vector<T>::erase(const_iterato
         _data[i] = std::move(_data[i + 1]);
     }
 
-    _data[_length - 1].~T();
+    alloc_traits::destroy(_alloc, _data + _length - 1);
 
     --_length;
 
     return begin() + index;
 }
 
-template<typename T>
+template<typename T, typename Allocator>
 template<typename... Args>
-typename vector<T>::reference vector<T>::emplace_back(Args&&... args) {
+typename vector<T, Allocator>::reference vector<T, Allocator>::emplace_back(Args&&... args) {
     if (_length == _capacity) {
         reserve(_capacity ? _capacity * 2 : 1);
     }
-    std::construct_at(_data + _length, std::forward<Args>(args)...);
+    alloc_traits::construct(_alloc, _data + _length, std::forward<Args>(args)...);
     return _data[_length++];
 }
 
-template<typename T> void vector<T>::pop_back() noexcept {
+template<typename T, typename Allocator> void vector<T, Allocator>::pop_back() noexcept {
     assert(_length >= 1);
-    std::destroy_at(_data + _length - 1);
+    alloc_traits::destroy(_alloc, _data + _length - 1);
     --_length;
 }
 
-template<typename T> void vector<T>::clear() noexcept {
-    std::destroy(_data, _data + _length);
+template<typename T, typename Allocator> void vector<T, Allocator>::clear() noexcept {
+    _destroy(_data, _data + _length);
     _length = 0;
 }
 
 // --- Private Helpers ---
 
-template<typename T> void vector<T>::_reallocate(size_type size) {
-    auto* new_mem{static_cast<T*>(::operator new(size * sizeof(T)))};
-    size_type i{};
-
-    try {
-        for (; i < _length; ++i) {
-            std::construct_at(new_mem + i, std::move_if_noexcept(_data[i]));
+template<typename T, typename Allocator> void vector<T, Allocator>::_reallocate(size_type size) {
+    if constexpr (detail::grows_with_realloc<T, Allocator>) {
+        if (size > max_size()) {
+            throw std::bad_array_new_length{};
         }
-    } catch (...) {
-        std::destroy(new_mem, new_mem + i);
-        ::operator delete(new_mem);
-        throw;
+        // On failure the old buffer is left untouched.
+        auto* new_mem{
+            static_cast<pointer>(std::realloc(static_cast<void*>(_data), size * sizeof(T)))};
+        if (!new_mem) {
+            throw std::bad_alloc{};
+        }
+        _data = new_mem;
+        _capacity = size;
+        return;
     }
 
-    std::destroy(_data, _data + _length);
-    ::operator delete(_data);
+    auto* new_mem{_allocate(size)};
+
+    if constexpr (detail::relocates_bitwise<T, Allocator>) {
+        if (_length != 0) {
+            std::memcpy(static_cast<void*>(new_mem), static_cast<const void*>(_data),
+                        _length * sizeof(T));
+        }
+    } else {
+        size_type i{};
+
+        try {
+            for (; i < _length; ++i) {
+                alloc_traits::construct(_alloc, new_mem + i, std::move_if_noexcept(_data[i]));
+            }
+        } catch (...) {
+            _destroy(new_mem, new_mem + i);
+            _deallocate(new_mem, size);
+            throw;
+        }
+
+        _destroy(_data, _data + _length);
+    }
+    _deallocate(_data, _capacity);
 
     _data = new_mem;
     _capacity = size;
 }
 
+// Capacity for at least `required` elements, doubling the current one to keep appends amortized.
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::size_type
+vector<T, Allocator>::_grown_capacity(size_type required) const {
+    if (required > max_size()) {
+        throw std::length_error("vector: length exceeds max_size()");
+    }
+    return std::max(required, std::min(_capacity * 2, max_size()));
+}
+
+// Constructs `count` elements in raw memory at `dest` from the sequence starting at `first`. If a
+// construction throws, the elements already built are destroyed again.
+template<typename T, typename Allocator>
+template<typename Iter>
+void vector<T, Allocator>::_construct_n(pointer dest, Iter first, size_type count) {
+    if constexpr (std::contiguous_iterator<Iter> && std::is_trivially_copyable_v<T> &&
+                  std::is_same_v<std::iter_value_t<Iter>, T> &&
+                  !detail::constructs_elements<Allocator, T>) {
+        if (count != 0) {
+            std::memcpy(dest, std::to_address(first), count * sizeof(T));
+        }
+    } else {
+        size_type i{};
+
+        try {
+            for (; i < count; ++i, ++first) {
+                alloc_traits::construct(_alloc, dest + i, *first);
+            }
+        } catch (...) {
+            _destroy(dest, dest + i);
+            throw;
+        }
+    }
+}
+
+// Inserts the `count` elements starting at `first` before position `index`, reading each of them
+// exactly once.
+template<typename T, typename Allocator>
+template<typename Iter>
+typename vector<T, Allocator>::iterator
+vector<T, Allocator>::_insert_n(size_type index, Iter first, size_type count) {
+    if (count == 0) {
+        return begin() + index;
+    }
+    if (count > max_size() - _length) {
+        throw std::length_error("vector: length exceeds max_size()");
+    }
+
+    const auto required{_length + count};
+    const auto tail{_length - index};
+
+    if constexpr (detail::relocates_bitwise<T, Allocator>) {
+        // Open the gap by moving the tail's bytes, and close it again if a construction throws.
+        if (required > _capacity) {
+            _reallocate(_grown_capacity(required));
+        }
+        auto* gap{_data + index};
+        std::memmove(static_cast<void*>(gap + count), static_cast<const void*>(gap),
+                     tail * sizeof(T));
+        try {
+            _construct_n(gap, first, count);
+        } catch (...) {
+            std::memmove(static_cast<void*>(gap), static_cast<const void*>(gap + count),
+                         tail * sizeof(T));
+            throw;
+        }
+    } else if (required > _capacity) {
+        // Build the new elements in a fresh buffer, then move the old ones around them. Until the
+        // old buffer is released a failure leaves the vector untouched.
+        const auto new_cap{_grown_capacity(required)};
+        auto* new_mem{_allocate(new_cap)};
+
+        try {
+            _construct_n(new_mem + index, first, count);
+        } catch (...) {
+            _deallocate(new_mem, new_cap);
+            throw;
+        }
+
+        size_type moved{};
+
+        try {
+            for (; moved < index; ++moved) {
+                alloc_traits::construct(_alloc, new_mem + moved,
+                                        std::move_if_noexcept(_data[moved]));
+            }
+            for (; moved < _length; ++moved) {
+                alloc_traits::construct(_alloc, new_mem + count + moved,
+                                        std::move_if_noexcept(_data[moved]));
+            }
+        } catch (...) {
+            _destroy(new_mem, new_mem + std::min(moved, index));
+            _destroy(new_mem + index, new_mem + index + count);
+            _destroy(new_mem + index + count, new_mem + count + std::max(moved, index));
+            _deallocate(new_mem, new_cap);
+            throw;
+        }
+
+        _destroy(_data, _data + _length);
+        _deallocate(_data, _capacity);
+
+        _data = new_mem;
+        _capacity = new_cap;
+    } else {
+        auto* insert_pos{_data + index};
+        auto* old_end{_data + _length};
+
+        if (tail > count) {
+            // The last `count` elements move into raw memory, the rest of the tail slides over
+            // live ones, and the new elements are assigned into the hole.
+            std::uninitialized_move(old_end - count, old_end, old_end);
+            _length = required;
+            std::move_backward(insert_pos, old_end - count, old_end);
+            std::ranges::copy_n(first, static_cast<difference_type>(count), insert_pos);
+        } else {
+            // The whole tail moves into raw memory; the first `tail` new elements are assigned to
+            // the slots it left and the others constructed after them.
+            std::uninitialized_move(insert_pos, old_end, insert_pos + count);
+            try {
+                const auto shifted{static_cast<difference_type>(tail)};
+                first = std::ranges::copy_n(first, shifted, insert_pos).in;
+                _construct_n(old_end, first, count - tail);
+            } catch (...) {
+                _destroy(insert_pos + count, old_end + count);
+                throw;
+            }
+        }
+    }
+
+    _length = required;
+
+    return begin() + index;
+}
+
+// Inserts a range that can only be read once: append it, then rotate it into place.
+template<typename T, typename Allocator>
+template<typename Iter, typename Sentinel>
+typename vector<T, Allocator>::iterator
+vector<T, Allocator>::_insert_each(size_type index, Iter first, Sentinel last) {
+    const auto old_length{_length};
+    for (; first != last; ++first) {
+        emplace_back(*first);
+    }
+    std::rotate(begin() + index, begin() + old_length, end());
+    return begin() + index;
+}
+
+// Replaces the contents with the `count` elements starting at `first`, reusing the buffer when it
+// is large enough and allocating exactly `count` slots when it is not.
+template<typename T, typename Allocator>
+template<typename Iter>
+void vector<T, Allocator>::_assign_n(Iter first, size_type count) {
+    if (count == 0) {
+        clear();
+        _release();
+        return;
+    }
+
+    if (count > _capacity) {
+        auto* new_mem{_allocate(count)};
+
+        try {
+            _construct_n(new_mem, first, count);
+        } catch (...) {
+            _deallocate(new_mem, count);
+            throw;
+        }
+
+        clear();
+        _deallocate(_data, _capacity);
+
+        _data = new_mem;
+        _capacity = count;
+        _length = count;
+        return;
+    }
+
+    const auto common{std::min(count, _length)};
+    first = std::ranges::copy_n(first, static_cast<difference_type>(common), _data).in;
+    if (count > _length) {
+        _construct_n(_data + _length, first, count - _length);
+    } else {
+        _destroy(_data + count, _data + _length);
+    }
+    _length = count;
+}
+
+template<typename T, typename Allocator>
+typename vector<T, Allocator>::pointer vector<T, Allocator>::_allocate(size_type count) {
+    if constexpr (detail::grows_with_realloc<T, Allocator>) {
+        if (count > max_size()) {
+            throw std::bad_array_new_length{};
+        }
+        auto* ptr{static_cast<pointer>(std::malloc(count * sizeof(T)))};
+        if (!ptr && count != 0) {
+            throw std::bad_alloc{};
+        }
+        return ptr;
+    } else {
+        return alloc_traits::allocate(_alloc, count);
+    }
+}
+
+template<typename T, typename Allocator>
+void vector<T, Allocator>::_deallocate(pointer ptr, size_type count) noexcept {
+    if constexpr (detail::grows_with_realloc<T, Allocator>) {
+        std::free(static_cast<void*>(ptr));
+    } else if (ptr) {
+        alloc_traits::deallocate(_alloc, ptr, count);
+    }
+}
+
+template<typename T, typename Allocator>
+void vector<T, Allocator>::_destroy(pointer first, pointer last) noexcept {
+    for (; first != last; ++first) {
+        alloc_traits::destroy(_alloc, first);
+    }
+}
+
+// Frees the buffer, elements must already be destroyed.
+template<typename T, typename Allocator> void vector<T, Allocator>::_release() noexcept {
+    _deallocate(_data, _capacity);
+    _data = nullptr;
+    _capacity = 0;
+}
+
+// The buffer is on the heap; only the allocator can tie a vector to its address.
+template<typename T, typename Allocator>
+struct is_trivially_relocatable<vector<T, Allocator>> : is_trivially_relocatable<Allocator> {};
+
 } // namespace nstd
 
 #endif // NSTD_VECTOR_HPP
\ No newline at end of file
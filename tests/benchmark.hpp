@@ -0,0 +1,21 @@
+#ifndef TESTS_BENCHMARK_HPP
+#define TESTS_BENCHMARK_HPP
+
+#include <chrono>
+#include <utility>
+
+namespace tests {
+
+// Wall-clock milliseconds taken by body(). The benchmark_* functions that use it run from the
+// nstd_benchmarks target only, so the unit tests stay fast and build-type independent. Bodies
+// should leave their result somewhere the caller prints or checks, or NDEBUG builds may drop them.
+template<typename Body> double time_ms(Body&& body) {
+    auto start = std::chrono::steady_clock::now();
+    std::forward<Body>(body)();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace tests
+
+#endif // TESTS_BENCHMARK_HPP
@@ -0,0 +1,31 @@
+#include "test_concurrent_memory_pool.hpp"
+#include "test_hash.hpp"
+#include "test_list.hpp"
+#include "test_rope.hpp"
+#include "test_split.hpp"
+#include "test_string_builder.hpp"
+#include "test_string_view.hpp"
+#include "test_unrolled_list.hpp"
+#include "test_utf8.hpp"
+#include "test_vector.hpp"
+
+// ------------------------- Benchmark Runner -------------------------
+// Timings against the standard library or a scalar baseline. Not registered with ctest; build in
+// Release and run nstd_benchmarks directly.
+int main() {
+    std::cout << "=== Running nstd Benchmarks ===\n\n";
+
+    tests::vector::benchmark_relocation_growth();
+    tests::vector::benchmark_range();
+    tests::list::benchmark_queue_workload();
+    tests::unrolled_list::benchmark_iteration();
+    tests::string_view::benchmark_log_scan();
+    tests::hash::benchmark_lookup();
+    tests::rope::benchmark_editing();
+    tests::string_builder::benchmark_message();
+    tests::utf8::benchmark_validation();
+    tests::split::benchmark_csv();
+    tests::concurrent_memory_pool::benchmark_message_passing();
+
+    return 0;
+}
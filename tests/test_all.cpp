@@ -1,10 +1,22 @@
+#include "test_arena.hpp"
+#include "test_concurrent_memory_pool.hpp"
 #include "test_expected.hpp"
 #include "test_function.hpp"
+#include "test_hash.hpp"
+#include "test_intrusive_list.hpp"
 #include "test_list.hpp"
 #include "test_memory_pool.hpp"
+#include "test_rope.hpp"
+#include "test_slab_allocator.hpp"
+#include "test_split.hpp"
 #include "test_stack.hpp"
 #include "test_string.hpp"
+#include "test_string_builder.hpp"
+#include "test_string_pool.hpp"
+#include "test_string_view.hpp"
 #include "test_thread_pool.hpp"
+#include "test_unrolled_list.hpp"
+#include "test_utf8.hpp"
 #include "test_variant.hpp"
 #include "test_vector.hpp"
 
@@ -24,6 +36,22 @@ int main() {
     tests::list::test_edge_cases();
     tests::list::test_multiple_types();
     tests::list::test_stress();
+    tests::list::test_splice();
+    tests::list::test_allocators();
+    tests::list::test_iterator_insert_erase();
+    tests::list::test_emplace();
+    tests::list::test_sort();
+    tests::list::test_sort_relinks_prev();
+    tests::list::test_sort_exception_safety();
+    tests::list::test_merge();
+    tests::list::test_unique_remove();
+    tests::list::test_static_storage_duration();
+
+    std::cout << "\n=== Unrolled List Tests ===\n";
+    tests::unrolled_list::run_all_tests();
+
+    std::cout << "\n=== Intrusive List Tests ===\n";
+    tests::intrusive_list::run_all_tests();
 
     std::cout << "\n=== String Tests ===\n";
     tests::string::test_construction();
@@ -38,9 +66,33 @@ int main() {
     tests::string::test_memory_safety();
     tests::string::test_edge_cases();
     tests::string::test_swap();
+    tests::string::test_allocator_propagation();
     tests::string::test_exception_safety();
     tests::string::test_stress();
     tests::string::test_type_aliases();
+    tests::string::test_small_string();
+    tests::string::test_append_growth();
+
+    std::cout << "\n=== String View Tests ===\n";
+    tests::string_view::run_all_tests();
+
+    std::cout << "\n=== Hash Tests ===\n";
+    tests::hash::run_all_tests();
+
+    std::cout << "\n=== String Pool Tests ===\n";
+    tests::string_pool::run_all_tests();
+
+    std::cout << "\n=== Rope Tests ===\n";
+    tests::rope::run_all_tests();
+
+    std::cout << "\n=== String Builder Tests ===\n";
+    tests::string_builder::run_all_tests();
+
+    std::cout << "\n=== UTF-8 Tests ===\n";
+    tests::utf8::run_all_tests();
+
+    std::cout << "\n=== Split Tests ===\n";
+    tests::split::run_all_tests();
 
     std::cout << "\n=== Stack Tests ===\n";
     tests::stack::test_basic_operations();
@@ -61,6 +113,15 @@ int main() {
     std::cout << "\n=== Memory Pool Tests ===\n";
     tests::memory_pool::run_all_tests();
 
+    std::cout << "\n=== Concurrent Memory Pool Tests ===\n";
+    tests::concurrent_memory_pool::run_all_tests();
+
+    std::cout << "\n=== Slab Allocator Tests ===\n";
+    tests::slab_allocator::run_all_tests();
+
+    std::cout << "\n=== Arena Tests ===\n";
+    tests::arena::run_all_tests();
+
     std::cout << "\n=== Variant Tests ===\n";
     tests::variant::run_all_tests();
 
@@ -0,0 +1,155 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "nstd/arena.hpp"
+#include "nstd/string.hpp"
+
+namespace tests {
+namespace arena {
+
+bool is_aligned(const void* ptr, size_t align) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % align == 0;
+}
+
+void test_bump_allocation() {
+    std::cout << "[Test] Bump Allocation... ";
+    nstd::arena a{256};
+
+    auto* p1 = static_cast<char*>(a.allocate(10, 1));
+    auto* p2 = static_cast<char*>(a.allocate(10, 1));
+
+    // Consecutive allocations come from the same chunk, back to back.
+    assert(p2 == p1 + 10);
+
+    std::memset(p1, 'x', 10);
+    std::memset(p2, 'y', 10);
+    assert(p1[9] == 'x' && p2[0] == 'y');
+
+    std::cout << "Passed.\n";
+}
+
+void test_alignment() {
+    std::cout << "[Test] Alignment... ";
+    nstd::arena a;
+
+    a.allocate(1, 1);
+    assert(is_aligned(a.allocate(8, 8), 8));
+    a.allocate(3, 1);
+    assert(is_aligned(a.allocate(16, 16), 16));
+    a.allocate(1, 1);
+    assert(is_aligned(a.allocate(64, 64), 64));
+
+    std::cout << "Passed.\n";
+}
+
+void test_chunk_growth() {
+    std::cout << "[Test] Chunk Growth / Oversized Requests... ";
+    nstd::arena a{64};
+
+    // Many small allocations spill over several geometrically growing chunks.
+    for (int i = 0; i < 1000; ++i) {
+        auto* p = static_cast<int*>(a.allocate(sizeof(int), alignof(int)));
+        *p = i;
+    }
+
+    // A request far larger than the current chunk size gets a chunk of its own.
+    auto* big = static_cast<char*>(a.allocate(1 << 20));
+    big[0] = 'a';
+    big[(1 << 20) - 1] = 'z';
+
+    std::cout << "Passed.\n";
+}
+
+void test_reset_reuses_memory() {
+    std::cout << "[Test] reset() Reuses Chunks... ";
+    nstd::arena a{128};
+
+    void* first = a.allocate(64);
+    for (int i = 0; i < 50; ++i) {
+        a.allocate(64);
+    }
+
+    a.reset();
+
+    // After a reset the arena starts again at the very first chunk.
+    void* again = a.allocate(64);
+    assert(again == first);
+
+    a.release();
+    assert(a.remaining() == 0);
+
+    std::cout << "Passed.\n";
+}
+
+void test_inline_buffer() {
+    std::cout << "[Test] Inline Buffer... ";
+    nstd::inline_arena<256> a;
+
+    auto* begin = reinterpret_cast<const char*>(&a);
+    auto* end = begin + sizeof(a);
+
+    // Fits in the inline buffer: served from inside the arena object.
+    auto* p = static_cast<const char*>(a.allocate(100));
+    assert(p >= begin && p < end);
+
+    // Does not fit anymore: spills to the heap.
+    auto* q = static_cast<const char*>(a.allocate(200));
+    assert(q < begin || q >= end);
+
+    // reset() goes back to the inline buffer.
+    a.reset();
+    assert(a.allocate(100) == p);
+
+    std::cout << "Passed.\n";
+}
+
+void test_allocator_with_containers() {
+    std::cout << "[Test] arena_allocator with containers... ";
+    nstd::inline_arena<1024> a;
+
+    using arena_string = nstd::basic_string<char, nstd::arena_allocator<char>>;
+
+    {
+        nstd::arena_allocator<char> alloc{a};
+        arena_string s{"request-id: ", alloc};
+        s += "12345";
+        s.push_back('!');
+        assert(s == arena_string("request-id: 12345!", alloc));
+        assert(s.get_allocator() == alloc);
+
+        // Copies stay in the same arena.
+        arena_string copy{s};
+        assert(copy.get_allocator() == alloc);
+    }
+
+    {
+        std::vector<int, nstd::arena_allocator<int>> v{nstd::arena_allocator<int>{a}};
+        for (int i = 0; i < 500; ++i) {
+            v.push_back(i);
+        }
+        assert(v[499] == 499);
+    }
+
+    // Everything above is gone in a single step.
+    a.reset();
+
+    std::cout << "Passed.\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running Arena Tests ===\n";
+
+    test_bump_allocation();
+    test_alignment();
+    test_chunk_growth();
+    test_reset_reuses_memory();
+    test_inline_buffer();
+    test_allocator_with_containers();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace arena
+} // namespace tests
@@ -0,0 +1,275 @@
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include "benchmark.hpp"
+#include "nstd/concurrent_memory_pool.hpp"
+#include "nstd/thread_pool.hpp"
+#include "nstd/vector.hpp"
+
+namespace tests {
+namespace concurrent_memory_pool {
+// ==========================================
+// Test Helpers
+// ==========================================
+
+struct Tracker {
+    static std::atomic<int> alive_count;
+    int value;
+
+    Tracker(int v) : value(v) {
+        alive_count++;
+    }
+
+    ~Tracker() {
+        alive_count--;
+    }
+};
+std::atomic<int> Tracker::alive_count = 0;
+
+struct Message {
+    size_t id;
+    size_t payload[7];
+};
+
+// Producer/consumer hand-off: producers fill slots, consumers spin on them and free the message.
+// Every message is therefore freed on a different thread than the one that allocated it.
+template<typename Alloc, typename Free>
+double run_message_passing(size_t messages_per_pair, size_t pairs, Alloc alloc, Free release) {
+    auto slots = std::make_unique<std::atomic<Message*>[]>(messages_per_pair * pairs);
+    nstd::thread_pool workers(static_cast<int>(pairs * 2));
+    nstd::vector<std::future<void>> futures;
+
+    return time_ms([&] {
+        for (size_t p = 0; p < pairs; ++p) {
+            auto* first = slots.get() + p * messages_per_pair;
+
+            auto producer = workers.enqueue([=, &alloc]() {
+                for (size_t i = 0; i < messages_per_pair; ++i) {
+                    first[i].store(alloc(i), std::memory_order_release);
+                }
+            });
+
+            auto consumer = workers.enqueue([=, &release]() {
+                for (size_t i = 0; i < messages_per_pair; ++i) {
+                    Message* msg{};
+                    while (!(msg = first[i].load(std::memory_order_acquire))) {
+                        std::this_thread::yield();
+                    }
+                    assert(msg->id == i);
+                    release(msg);
+                }
+            });
+
+            assert(producer.has_value() && consumer.has_value());
+            futures.push_back(std::move(producer.value()));
+            futures.push_back(std::move(consumer.value()));
+        }
+
+        for (auto& f : futures) {
+            f.get();
+        }
+    });
+}
+
+// ==========================================
+// Tests
+// ==========================================
+
+void test_basic_allocation() {
+    std::cout << "[Test] Basic Allocation... ";
+    nstd::concurrent_memory_pool<int> pool;
+
+    int* a = pool.allocate(10);
+    int* b = pool.allocate(20);
+
+    assert(*a == 10);
+    assert(*b == 20);
+    assert(a != b);
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+    std::cout << "Passed.\n";
+}
+
+void test_address_reuse() {
+    std::cout << "[Test] Address Reuse (thread cache is LIFO)... ";
+    nstd::concurrent_memory_pool<int> pool;
+
+    int* ptr1 = pool.allocate(42);
+    void* addr1 = ptr1;
+    pool.deallocate(ptr1);
+
+    int* ptr2 = pool.allocate(99);
+    assert(ptr2 == addr1);
+    assert(*ptr2 == 99);
+
+    pool.deallocate(ptr2);
+    std::cout << "Passed.\n";
+}
+
+void test_batch_refill_and_flush() {
+    std::cout << "[Test] Batch Refill / Flush... ";
+
+    // Tiny batches so a few hundred allocations go through the depot many times.
+    nstd::concurrent_memory_pool<size_t, 8, 4> pool;
+    nstd::vector<size_t*> ptrs;
+
+    for (size_t i = 0; i < 300; ++i) {
+        ptrs.push_back(pool.allocate(i));
+    }
+
+    for (size_t i = 0; i < ptrs.size(); ++i) {
+        assert(*ptrs[i] == i);
+    }
+
+    for (auto* p : ptrs) {
+        pool.deallocate(p);
+    }
+
+    // Flushed blocks must be reusable.
+    ptrs.clear();
+    for (size_t i = 0; i < 300; ++i) {
+        ptrs.push_back(pool.allocate(i * 2));
+    }
+    for (size_t i = 0; i < ptrs.size(); ++i) {
+        assert(*ptrs[i] == i * 2);
+        pool.deallocate(ptrs[i]);
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_destructor_call() {
+    std::cout << "[Test] Destructor Calls... ";
+    Tracker::alive_count = 0;
+
+    nstd::concurrent_memory_pool<Tracker> pool;
+
+    Tracker* t1 = pool.allocate(1);
+    Tracker* t2 = pool.allocate(2);
+    assert(Tracker::alive_count == 2);
+
+    pool.deallocate(t1);
+    assert(Tracker::alive_count == 1);
+
+    pool.deallocate(t2);
+    assert(Tracker::alive_count == 0);
+
+    std::cout << "Passed.\n";
+}
+
+void test_cross_thread_free() {
+    std::cout << "[Test] Cross-Thread Free... ";
+
+    nstd::concurrent_memory_pool<size_t, 16, 8> pool;
+    nstd::vector<size_t*> ptrs;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        ptrs.push_back(pool.allocate(i));
+    }
+
+    // Free everything on another thread, which then exits and flushes its cache.
+    std::thread([&]() {
+        for (auto* p : ptrs) {
+            pool.deallocate(p);
+        }
+    }).join();
+
+    // The blocks must come back to this thread through the depot without new chunks.
+    nstd::vector<size_t*> again;
+    for (size_t i = 0; i < 1000; ++i) {
+        again.push_back(pool.allocate(i));
+    }
+
+    for (size_t i = 0; i < again.size(); ++i) {
+        assert(*again[i] == i);
+        pool.deallocate(again[i]);
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_pool_outlived_by_thread() {
+    std::cout << "[Test] Pool Destroyed Before Worker Thread... ";
+
+    std::atomic<bool> pool_gone{false};
+    std::atomic<int*> handoff{nullptr};
+
+    std::thread worker;
+    {
+        nstd::concurrent_memory_pool<int> pool;
+        worker = std::thread([&]() {
+            int* p = pool.allocate(7);
+            handoff.store(p);
+            while (!pool_gone.load()) {
+                std::this_thread::yield();
+            }
+            // Thread exit runs cache teardown against a closed depot.
+        });
+
+        while (!handoff.load()) {
+            std::this_thread::yield();
+        }
+        pool.deallocate(handoff.load());
+    }
+    pool_gone.store(true);
+    worker.join();
+
+    // A fresh pool on this thread must not pick up stale caches.
+    nstd::concurrent_memory_pool<int> pool;
+    int* p = pool.allocate(1);
+    assert(*p == 1);
+    pool.deallocate(p);
+
+    std::cout << "Passed.\n";
+}
+
+// Destroyed during exit, after the main thread's caches are gone.
+nstd::concurrent_memory_pool<long> static_pool;
+
+void test_static_storage_duration() {
+    std::cout << "[Test] Pool With Static Storage Duration... ";
+    long* kept = static_pool.allocate(1);
+    long* freed = static_pool.allocate(2);
+    static_pool.deallocate(freed);
+    assert(*kept == 1);
+    std::cout << "Passed.\n";
+}
+
+void benchmark_message_passing() {
+    std::cout << "[Benchmark] Producer/Consumer Message Passing vs new/delete...\n";
+
+    constexpr size_t messages_per_pair = 200000;
+    constexpr size_t pairs = 2;
+
+    auto heap_ms = run_message_passing(
+        messages_per_pair, pairs, [](size_t i) { return new Message{i, {}}; },
+        [](Message* msg) { delete msg; });
+
+    nstd::concurrent_memory_pool<Message, 4096, 64> pool;
+    auto pool_ms = run_message_passing(
+        messages_per_pair, pairs, [&pool](size_t i) { return pool.allocate(Message{i, {}}); },
+        [&pool](Message* msg) { pool.deallocate(msg); });
+
+    std::cout << "    new/delete:             " << heap_ms << "ms\n";
+    std::cout << "    concurrent_memory_pool: " << pool_ms << "ms\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running Concurrent Memory Pool Tests ===\n";
+
+    test_basic_allocation();
+    test_address_reuse();
+    test_batch_refill_and_flush();
+    test_destructor_call();
+    test_cross_thread_free();
+    test_pool_outlived_by_thread();
+    test_static_storage_duration();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace concurrent_memory_pool
+} // namespace tests
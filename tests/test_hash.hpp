@@ -0,0 +1,155 @@
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "nstd/hash.hpp"
+#include "nstd/hashed_string.hpp"
+#include "nstd/string.hpp"
+
+namespace tests {
+namespace hash {
+
+void test_hash_bytes() {
+    std::cout << "[Test] hash_bytes Properties... ";
+    const std::string text(300, 'x');
+
+    // Deterministic, seeded, and covers every length path (0-3, 4-16, 17-48, > 48 bytes).
+    std::unordered_set<std::uint64_t> seen;
+    for (size_t length = 0; length <= text.size(); ++length) {
+        const auto h = nstd::hash_bytes(text.data(), length);
+        assert(h == nstd::hash_bytes(text.data(), length));
+        assert(h != nstd::hash_bytes(text.data(), length, 1));
+        seen.insert(h);
+    }
+    assert(seen.size() == text.size() + 1);
+
+    // Every single-bit flip in a 64-byte input changes the hash.
+    unsigned char block[64]{};
+    const auto base = nstd::hash_bytes(block, sizeof(block));
+    for (size_t bit = 0; bit < sizeof(block) * 8; ++bit) {
+        block[bit / 8] ^= static_cast<unsigned char>(1u << (bit % 8));
+        assert(nstd::hash_bytes(block, sizeof(block)) != base);
+        block[bit / 8] ^= static_cast<unsigned char>(1u << (bit % 8));
+    }
+
+    // No collisions over many similar keys.
+    std::unordered_set<std::uint64_t> keys;
+    for (int i = 0; i < 200000; ++i) {
+        const auto key = "metric.requests.host-" + std::to_string(i);
+        keys.insert(nstd::hash_bytes(key.data(), key.size()));
+    }
+    assert(keys.size() == 200000);
+
+    std::cout << "Passed.\n";
+}
+
+void test_string_hash() {
+    std::cout << "[Test] Hashing nstd Strings... ";
+    const nstd::string key{"service.latency.p99"};
+    const nstd::string_view view{key};
+
+    // Strings and views of the same characters hash equally, through nstd:: and std::hash.
+    assert(nstd::hash<nstd::string>{}(key) == nstd::hash<nstd::string_view>{}(view));
+    assert(std::hash<nstd::string>{}(key) == std::hash<nstd::string_view>{}(view));
+    assert(nstd::hash<nstd::string>{}(key) == nstd::hash_bytes(key.data(), key.size()));
+
+    // Heterogeneous lookup: probing with a view does not build a temporary string.
+    std::unordered_map<nstd::string, int, nstd::hash<nstd::string>, std::equal_to<>> counts;
+    counts[nstd::string{"alpha"}] = 1;
+    counts[nstd::string{"beta"}] = 2;
+    const char buffer[] = "alphabet";
+    assert(counts.find(nstd::string_view{buffer, 5})->second == 1);
+    assert(counts.find(nstd::string_view{buffer, 4}) == counts.end());
+    assert(counts.count(nstd::string_view{"beta"}) == 1);
+
+    std::cout << "Passed.\n";
+}
+
+void test_hashed_string() {
+    std::cout << "[Test] hashed_string... ";
+    nstd::hashed_string empty;
+    assert(empty.empty() && empty.hash() == nstd::hash<nstd::string_view>{}(""));
+
+    nstd::hashed_string a{"user:42"};
+    nstd::hashed_string b{nstd::string{"user:42"}};
+    nstd::hashed_string c{nstd::string_view{"user:43"}};
+    assert(a.hash() == b.hash() && a == b);
+    assert(a.hash() != c.hash() && !(a == c));
+    assert(a.size() == 7 && a.view() == "user:42" && a.str() == nstd::string("user:42"));
+    assert(std::hash<nstd::hashed_string>{}(a) == a.hash());
+
+    // Long keys stay on the heap, the cached hash travels with them.
+    nstd::hashed_string long_key{"tenant/eu-west-1/cluster-7/namespace/payments/pod-3"};
+    auto moved{std::move(long_key)};
+    assert(moved.hash() == nstd::hash<nstd::string_view>{}(moved.view()));
+    swap(moved, a);
+    assert(a.size() > 40 && moved == b);
+
+    std::unordered_map<nstd::hashed_string, int, nstd::hash<nstd::hashed_string>, std::equal_to<>>
+        table;
+    table.emplace("cpu", 1);
+    table.emplace("memory", 2);
+    assert(table.at(nstd::hashed_string{"memory"}) == 2);
+    assert(table.find(nstd::string_view{"cpu"})->second == 1);
+
+    std::cout << "Passed.\n";
+}
+
+void benchmark_lookup() {
+    std::cout << "[Benchmark] Lookup with Cached Hashes...\n";
+    constexpr int count = 20000;
+
+    // Keys that share a long prefix are the expensive case for hashing and comparing.
+    std::vector<nstd::string> names;
+    for (int i = 0; i < count; ++i) {
+        names.emplace_back(nstd::string_view{
+            ("cluster/eu-west-1/service/checkout/instance/" + std::to_string(i)).c_str()});
+    }
+
+    std::unordered_map<nstd::string, int, nstd::hash<nstd::string>> plain;
+    std::unordered_map<nstd::hashed_string, int, nstd::hash<nstd::hashed_string>> cached;
+    std::vector<nstd::hashed_string> hashed_names;
+    for (int i = 0; i < count; ++i) {
+        plain.emplace(names[i], i);
+        hashed_names.emplace_back(names[i]);
+        cached.emplace(hashed_names.back(), i);
+    }
+
+    auto time_lookups = [](const auto& table, const auto& keys) {
+        long long sum = 0;
+        const auto ms = time_ms([&] {
+            for (int round = 0; round < 20; ++round) {
+                for (const auto& key : keys) {
+                    sum += table.find(key)->second;
+                }
+            }
+        });
+        assert(sum == 20LL * (count - 1LL) * count / 2);
+        return std::pair{ms, sum};
+    };
+
+    // The sums are printed so the lookups stay observable when NDEBUG compiles the asserts out.
+    const auto [plain_ms, plain_sum] = time_lookups(plain, names);
+    const auto [cached_ms, cached_sum] = time_lookups(cached, hashed_names);
+    std::cout << "    nstd::string keys:        " << plain_ms << "ms (sum " << plain_sum << ")\n";
+    std::cout << "    nstd::hashed_string keys: " << cached_ms << "ms (sum " << cached_sum << ")\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running Hash Tests ===\n";
+
+    test_hash_bytes();
+    test_string_hash();
+    test_hashed_string();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace hash
+} // namespace tests
@@ -0,0 +1,255 @@
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "nstd/intrusive_list.hpp"
+
+namespace tests {
+namespace intrusive_list {
+
+struct Connection {
+    explicit Connection(int id) : id{id} {}
+
+    int id;
+    nstd::list_hook<> by_state;
+    nstd::list_hook<> by_idle;
+};
+
+struct Timer {
+    explicit Timer(int deadline) : deadline{deadline} {}
+
+    int deadline;
+    nstd::list_hook<nstd::link_mode::auto_unlink> hook;
+};
+
+using connection_list = nstd::intrusive_list<Connection, &Connection::by_state>;
+using idle_list = nstd::intrusive_list<Connection, &Connection::by_idle>;
+using timer_list = nstd::intrusive_list<Timer, &Timer::hook>;
+
+template<typename List> std::vector<int> ids(const List& l) {
+    std::vector<int> out;
+    for (const auto& c : l) {
+        out.push_back(c.id);
+    }
+    return out;
+}
+
+void test_push_pop() {
+    std::cout << "[Test] Push / Pop / Iterate... ";
+    Connection a{1}, b{2}, c{3};
+
+    {
+        connection_list l;
+        assert(l.empty() && l.size() == 0 && l.begin() == l.end());
+
+        l.push_back(b);
+        l.push_back(c);
+        l.push_front(a);
+        assert(l.size() == 3);
+        assert(&l.front() == &a && &l.back() == &c);
+        assert((ids(l) == std::vector<int>{1, 2, 3}));
+
+        // The list hands out the objects themselves.
+        assert(&*l.begin() == &a && l.begin()->id == 1);
+
+        std::vector<int> backwards;
+        for (auto it = l.end(); it != l.begin();) {
+            --it;
+            backwards.push_back(it->id);
+        }
+        assert((backwards == std::vector<int>{3, 2, 1}));
+
+        l.pop_front();
+        l.pop_back();
+        assert(l.size() == 1 && &l.front() == &b);
+        assert(!a.by_state.is_linked() && b.by_state.is_linked() && !c.by_state.is_linked());
+    }
+
+    // Destroying the list unlinks what was left in it.
+    assert(!b.by_state.is_linked());
+
+    std::cout << "Passed.\n";
+}
+
+void test_insert_erase() {
+    std::cout << "[Test] Iterator Insert / Erase / iterator_to... ";
+    std::vector<Connection> pool;
+    for (int i = 0; i < 6; ++i) {
+        pool.emplace_back(i);
+    }
+
+    connection_list l;
+    for (int i : {0, 2, 4}) {
+        l.push_back(pool[i]);
+    }
+
+    auto it = l.insert(std::next(l.begin()), pool[1]);
+    assert(it->id == 1);
+    l.insert(l.end(), pool[5]);
+    l.insert(l.iterator_to(pool[4]), pool[3]);
+    assert((ids(l) == std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+    // Erase by object in O(1): no search through the list.
+    auto next = l.erase(l.iterator_to(pool[2]));
+    assert(next->id == 3);
+    assert(!pool[2].by_state.is_linked());
+
+    auto last = l.erase(l.iterator_to(pool[3]), l.end());
+    assert(last == l.end());
+    assert((ids(l) == std::vector<int>{0, 1}) && l.size() == 2);
+
+    const connection_list& cl = l;
+    connection_list::const_iterator cit = l.begin();
+    assert(cit == cl.begin() && cl.iterator_to(pool[1]) == std::next(cl.begin()));
+
+    l.clear();
+    assert(l.empty());
+    for (const auto& c : pool) {
+        assert(!c.by_state.is_linked());
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_multiple_hooks() {
+    std::cout << "[Test] One Object in Several Lists... ";
+    Connection a{1}, b{2}, c{3};
+
+    connection_list active;
+    idle_list idle;
+    active.push_back(a);
+    active.push_back(b);
+    active.push_back(c);
+    idle.push_back(c);
+    idle.push_back(a);
+
+    assert((ids(active) == std::vector<int>{1, 2, 3}));
+    assert((ids(idle) == std::vector<int>{3, 1}));
+
+    // Leaving one list does not affect the other.
+    idle.erase(idle.iterator_to(c));
+    assert((ids(active) == std::vector<int>{1, 2, 3}));
+    assert((ids(idle) == std::vector<int>{1}));
+
+    active.clear();
+    idle.clear();
+
+    std::cout << "Passed.\n";
+}
+
+void test_auto_unlink() {
+    std::cout << "[Test] Auto-Unlink Hooks... ";
+    timer_list timers;
+    Timer t1{10};
+    Timer t3{30};
+    timers.push_back(t1);
+
+    {
+        Timer t2{20};
+        timers.push_back(t2);
+        timers.push_back(t3);
+        assert(timers.size() == 3);
+    }
+
+    // t2 took itself out when it was destroyed.
+    assert(timers.size() == 2);
+    assert(&timers.front() == &t1 && &timers.back() == &t3);
+
+    // An object can leave without any access to the list.
+    t1.hook.unlink();
+    assert(!t1.hook.is_linked());
+    assert(timers.size() == 1 && &timers.front() == &t3);
+
+    // Unlinking twice is harmless.
+    t1.hook.unlink();
+
+    // Copies of an object are not in the list.
+    Timer copy{t3};
+    assert(!copy.hook.is_linked() && timers.size() == 1);
+
+    std::cout << "Passed.\n";
+}
+
+void test_splice() {
+    std::cout << "[Test] Splice... ";
+    std::vector<Connection> pool;
+    for (int i = 0; i < 6; ++i) {
+        pool.emplace_back(i);
+    }
+
+    connection_list first, second;
+    for (int i = 0; i < 3; ++i) {
+        first.push_back(pool[i]);
+        second.push_back(pool[i + 3]);
+    }
+
+    first.splice(std::next(first.begin()), second);
+    assert(second.empty() && second.size() == 0);
+    assert((ids(first) == std::vector<int>{0, 3, 4, 5, 1, 2}));
+    assert(first.size() == 6);
+
+    second.splice(second.end(), first, first.iterator_to(pool[4]));
+    second.splice(second.begin(), first, first.begin());
+    assert((ids(first) == std::vector<int>{3, 5, 1, 2}) && first.size() == 4);
+    assert((ids(second) == std::vector<int>{0, 4}) && second.size() == 2);
+
+    // Splicing an element in front of itself or its successor is a no-op.
+    first.splice(first.begin(), first, first.begin());
+    first.splice(std::next(first.begin()), first, first.begin());
+    assert((ids(first) == std::vector<int>{3, 5, 1, 2}));
+
+    first.clear();
+    second.clear();
+
+    std::cout << "Passed.\n";
+}
+
+void test_move_swap() {
+    std::cout << "[Test] Move / Swap... ";
+    Connection a{1}, b{2}, c{3};
+
+    connection_list l;
+    l.push_back(a);
+    l.push_back(b);
+
+    // The neighbours of the sentinel follow it to the new list object.
+    connection_list moved{std::move(l)};
+    assert(l.empty() && moved.size() == 2);
+    assert((ids(moved) == std::vector<int>{1, 2}));
+    assert(&*std::prev(moved.end()) == &b);
+
+    connection_list other;
+    other.push_back(c);
+    swap(moved, other);
+    assert((ids(moved) == std::vector<int>{3}) && (ids(other) == std::vector<int>{1, 2}));
+
+    // Empty on either side.
+    connection_list empty;
+    swap(empty, other);
+    assert(other.empty() && (ids(empty) == std::vector<int>{1, 2}));
+    assert(&*std::prev(empty.end()) == &b && other.begin() == other.end());
+
+    moved = std::move(empty);
+    assert(!c.by_state.is_linked());
+    assert((ids(moved) == std::vector<int>{1, 2}) && empty.empty());
+
+    moved.clear();
+
+    std::cout << "Passed.\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running Intrusive List Tests ===\n";
+
+    test_push_pop();
+    test_insert_erase();
+    test_multiple_hooks();
+    test_auto_unlink();
+    test_splice();
+    test_move_swap();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace intrusive_list
+} // namespace tests
@@ -1,11 +1,18 @@
 #ifndef TESTS_LIST_HPP
 #define TESTS_LIST_HPP
 
+#include "benchmark.hpp"
+#include "nstd/arena.hpp"
 #include "nstd/list.hpp"
 #include <cassert>
 #include <iostream>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace tests {
 namespace list {
@@ -102,6 +109,33 @@ void test_insert_erase() {
     l.erase(3);
     assert(l.size() == 3);
     assert(l.back() == 4);
+
+    // every index, so both the walk from the front and the one from the back are covered
+    auto matches = [](const nstd::list<int>& actual, const std::vector<int>& expected) {
+        std::vector<int> values;
+        for (int x : actual)
+            values.push_back(x);
+        return values == expected;
+    };
+    for (size_t size = 1; size <= 9; ++size) {
+        for (size_t pos = 0; pos <= size; ++pos) {
+            nstd::list<int> grown;
+            std::vector<int> expected;
+            for (size_t i = 0; i < size; ++i) {
+                grown.push_back(static_cast<int>(i));
+                expected.push_back(static_cast<int>(i));
+            }
+            grown.insert(pos, -1);
+            expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(pos), -1);
+            assert(matches(grown, expected));
+
+            grown.erase(pos < size ? pos + 1 : pos - 1);
+            expected.erase(expected.begin() +
+                           static_cast<std::ptrdiff_t>(pos < size ? pos + 1 : pos - 1));
+            assert(grown.size() == size);
+            assert(matches(grown, expected));
+        }
+    }
 }
 
 // ------------------------- Copy / Move Semantics -------------------------
@@ -286,6 +320,482 @@ void test_stress() {
     l.clear();
     assert(l.empty());
 }
+
+// ------------------------- Splice -------------------------
+template<typename List> bool equals(const List& l, std::initializer_list<int> expected) {
+    if (l.size() != expected.size()) {
+        return false;
+    }
+    auto it = l.begin();
+    for (int x : expected) {
+        if (*it != x)
+            return false;
+        ++it;
+    }
+    return it == l.end();
+}
+
+void test_splice() {
+    std::cout << "--- Running Splice Test ---\n";
+
+    nstd::list<int> a, b;
+    for (int i = 1; i <= 3; ++i)
+        a.push_back(i);
+    for (int i = 7; i <= 9; ++i)
+        b.push_back(i);
+
+    // Whole list into the middle: nodes are relinked, not copied.
+    const int* seven = &b.front();
+    auto pos = a.begin();
+    ++pos;
+    a.splice(pos, b);
+    assert(equals(a, {1, 7, 8, 9, 2, 3}));
+    assert(b.empty() && b.begin() == b.end());
+    assert(&*(++a.begin()) == seven);
+
+    // Single node to the end of another list, then back to the front.
+    auto two = a.begin();
+    for (int i = 0; i < 4; ++i)
+        ++two;
+    b.splice(b.end(), a, two);
+    assert(equals(a, {1, 7, 8, 9, 3}));
+    assert(equals(b, {2}));
+    b.splice(b.begin(), a, a.begin());
+    assert(equals(b, {1, 2}));
+    assert(a.front() == 7);
+
+    // Range [8, 3) into the end of b.
+    auto first = ++a.begin();
+    auto last = first;
+    ++last;
+    ++last;
+    b.splice(b.end(), a, first, last);
+    assert(equals(a, {7, 3}));
+    assert(equals(b, {1, 2, 8, 9}));
+    assert(a.back() == 3 && b.back() == 9);
+
+    // Within the same list: move the last node to the front.
+    auto back = b.begin();
+    for (int i = 0; i < 3; ++i)
+        ++back;
+    b.splice(b.begin(), b, back);
+    assert(equals(b, {9, 1, 2, 8}));
+
+    // Rvalue whole-list form into an empty list.
+    nstd::list<int> c;
+    c.splice(c.end(), std::move(b));
+    assert(equals(c, {9, 1, 2, 8}));
+    assert(b.empty());
+}
+
+// ------------------------- Allocators -------------------------
+void test_allocators() {
+    std::cout << "--- Running Allocator Test ---\n";
+
+    // Default pooled nodes: a freed node is reused by the next allocation of the same type,
+    // even from another list.
+    {
+        nstd::list<int> a;
+        a.push_back(1);
+        const int* freed = &a.front();
+        a.pop_back();
+
+        nstd::list<int> b;
+        b.push_back(2);
+        assert(&b.front() == freed);
+    }
+
+    // Plain heap nodes.
+    {
+        nstd::list<std::string, std::allocator<std::string>> l;
+        l.push_back("heap");
+        l.push_front("nodes");
+        nstd::list<std::string, std::allocator<std::string>> copy{l};
+        assert(copy.front() == "nodes" && copy.back() == "heap");
+    }
+
+    // Arena nodes: everything lives in the inline buffer and is dropped at once.
+    {
+        nstd::inline_arena<4096> arena;
+        using arena_list = nstd::list<int, nstd::arena_allocator<int>>;
+        auto* begin = reinterpret_cast<const char*>(&arena);
+        auto* end = begin + sizeof(arena);
+
+        arena_list l{nstd::arena_allocator<int>{arena}};
+        for (int i = 0; i < 10; ++i)
+            l.push_back(i);
+        auto* node = reinterpret_cast<const char*>(&l.back());
+        assert(node >= begin && node < end);
+
+        // Copies keep the source's arena; splice between lists of the same arena is O(1).
+        arena_list other{l};
+        assert(other.get_allocator() == l.get_allocator());
+        other.splice(other.begin(), l);
+        assert(other.size() == 20 && l.empty());
+        assert(other.front() == 0 && other.back() == 9);
+
+        // arena_allocator propagates on move assignment, so the nodes and their arena move over.
+        nstd::inline_arena<1024> second;
+        arena_list moved{nstd::arena_allocator<int>{second}};
+        moved = std::move(other);
+        assert(moved.size() == 20);
+        assert(moved.get_allocator() == nstd::arena_allocator<int>{arena});
+    }
+}
+
+// ------------------------- Iterator Insert / Erase -------------------------
+void test_iterator_insert_erase() {
+    std::cout << "--- Running Iterator Insert / Erase Test ---\n";
+
+    nstd::list<int> l;
+
+    // Into an empty list, then at both ends and in the middle.
+    auto it = l.insert(l.end(), 2);
+    assert(*it == 2 && l.size() == 1);
+    l.insert(l.begin(), 0);
+    l.insert(l.end(), 4);
+    auto three = l.insert(++(++l.begin()), 3);
+    assert(*three == 3);
+    int one = 1;
+    auto inserted = l.insert(++l.begin(), one);
+    assert(*inserted == 1);
+    assert(equals(l, {0, 1, 2, 3, 4}));
+    assert(l.front() == 0 && l.back() == 4);
+
+    // Iterators to other elements stay valid across insert/erase.
+    auto two = ++(++l.begin());
+    auto next = l.erase(three);
+    assert(*next == 4);
+    assert(*two == 2);
+    assert(equals(l, {0, 1, 2, 4}));
+
+    // Erasing the last element returns end(); erasing the first moves head.
+    assert(l.erase(next) == l.end());
+    assert(l.back() == 2);
+    assert(*l.erase(l.begin()) == 1);
+    assert(equals(l, {1, 2}));
+
+    // Range erase.
+    for (int i = 3; i <= 6; ++i)
+        l.push_back(i);
+    auto first = ++l.begin();
+    auto last = first;
+    for (int i = 0; i < 3; ++i)
+        ++last;
+    auto after = l.erase(first, last);
+    assert(*after == 5);
+    assert(equals(l, {1, 5, 6}));
+    assert(l.erase(l.begin(), l.end()) == l.end());
+    assert(l.empty() && l.begin() == l.end());
+
+    // The list keeps working after being emptied through iterators.
+    l.push_back(7);
+    l.push_front(6);
+    assert(equals(l, {6, 7}));
+}
+
+// ------------------------- Emplace -------------------------
+struct Immovable {
+    int a;
+    std::string b;
+
+    Immovable(int a_, std::string b_) : a(a_), b(std::move(b_)) {}
+    Immovable(const Immovable&) = delete;
+    Immovable& operator=(const Immovable&) = delete;
+};
+
+struct CopyCounter {
+    static inline int copies = 0;
+    int value;
+
+    explicit CopyCounter(int v) : value(v) {}
+    CopyCounter(const CopyCounter& other) : value(other.value) {
+        ++copies;
+    }
+};
+
+void test_emplace() {
+    std::cout << "--- Running Emplace Test ---\n";
+
+    // Elements are built inside the node, so even immovable types work.
+    nstd::list<Immovable> l;
+    auto& back = l.emplace_back(2, "two");
+    assert(&back == &l.back() && back.a == 2);
+    l.emplace_front(0, "zero");
+    auto mid = l.emplace(++l.begin(), 1, "one");
+    assert(mid->a == 1 && mid->b == "one");
+
+    int expected = 0;
+    for (const auto& x : l)
+        assert(x.a == expected++);
+    l.erase(mid);
+    assert(l.size() == 2 && l.front().b == "zero" && l.back().b == "two");
+
+    // No copies are made on the way into the node.
+    CopyCounter::copies = 0;
+    nstd::list<CopyCounter> counters;
+    counters.emplace_back(1);
+    counters.emplace_front(0);
+    counters.emplace(counters.end(), 2);
+    assert(CopyCounter::copies == 0);
+    assert(counters.front().value == 0 && counters.back().value == 2);
+}
+
+// ------------------------- Sort / Merge / Unique / Remove -------------------------
+void test_sort() {
+    std::cout << "--- Running Sort Test ---\n";
+
+    nstd::list<int> empty;
+    empty.sort();
+    assert(empty.empty());
+
+    // Random data against std::sort, including an odd length.
+    std::mt19937 rng(42);
+    std::vector<int> reference;
+    nstd::list<int> l;
+    for (int i = 0; i < 10001; ++i) {
+        int x = static_cast<int>(rng() % 1000);
+        reference.push_back(x);
+        l.push_back(x);
+    }
+    std::sort(reference.begin(), reference.end());
+    l.sort();
+    assert(l.size() == reference.size());
+    auto ref = reference.begin();
+    for (int x : l)
+        assert(x == *ref++);
+    assert(l.front() == reference.front() && l.back() == reference.back());
+
+    // Custom comparator, descending.
+    l.sort(std::greater<>{});
+    assert(l.front() == reference.back() && l.back() == reference.front());
+
+    // Stable: equal keys keep their insertion order.
+    nstd::list<std::pair<int, int>> pairs;
+    for (int i = 0; i < 100; ++i)
+        pairs.push_back({i % 3, i});
+    pairs.sort([](const auto& a, const auto& b) { return a.first < b.first; });
+    int last_key = -1, last_seq = -1;
+    for (const auto& [key, seq] : pairs) {
+        if (key == last_key)
+            assert(seq > last_seq);
+        last_key = key;
+        last_seq = seq;
+    }
+
+    // Immovable elements are sorted by relinking only.
+    nstd::list<Immovable> immovable;
+    for (int x : {3, 1, 2})
+        immovable.emplace_back(x, std::to_string(x));
+    const Immovable* one = nullptr;
+    for (const auto& x : immovable)
+        if (x.a == 1)
+            one = &x;
+    immovable.sort([](const Immovable& a, const Immovable& b) { return a.a < b.a; });
+    assert(&immovable.front() == one);
+    assert(immovable.back().b == "3");
+}
+
+void test_sort_relinks_prev() {
+    std::cout << "--- Running Sort Backward Links Test ---\n";
+
+    nstd::list<int> l;
+    for (int x : {5, 3, 9, 1, 7})
+        l.push_back(x);
+    l.sort();
+
+    // Walk backwards from the last element.
+    auto it = l.begin();
+    for (int i = 0; i < 4; ++i)
+        ++it;
+    for (int expected : {9, 7, 5, 3, 1}) {
+        assert(*it == expected);
+        if (expected != 1)
+            --it;
+    }
+
+    // The list still links correctly at both ends.
+    l.push_back(10);
+    l.push_front(0);
+    assert(equals(l, {0, 1, 3, 5, 7, 9, 10}));
+}
+
+void test_sort_exception_safety() {
+    std::cout << "--- Running Sort Exception Safety Test ---\n";
+
+    nstd::list<int> l;
+    for (int i = 100; i > 0; --i)
+        l.push_back(i);
+
+    int budget = 200;
+    bool thrown = false;
+    try {
+        l.sort([&budget](int a, int b) {
+            if (--budget == 0)
+                throw std::runtime_error("comparator failed");
+            return a < b;
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // Every element survives (in some order) and the list is usable.
+    assert(l.size() == 100);
+    long long sum = 0;
+    size_t walked = 0;
+    for (int x : l) {
+        sum += x;
+        ++walked;
+    }
+    assert(walked == 100 && sum == 5050);
+    l.sort();
+    assert(l.front() == 1 && l.back() == 100);
+
+    // A throw on every possible comparison, including those of the final merge of the bins
+    // ({3, 2, 1} throws there on the second call). The walk is bounded so a cycle fails the test.
+    for (int n = 2; n <= 12; ++n) {
+        for (int throw_at = 1;; ++throw_at) {
+            nstd::list<int> small;
+            for (int i = n; i > 0; --i)
+                small.push_back(i);
+
+            int calls = 0;
+            bool failed = false;
+            try {
+                small.sort([&](int a, int b) {
+                    if (++calls == throw_at)
+                        throw std::runtime_error("comparator failed");
+                    return a < b;
+                });
+            } catch (const std::runtime_error&) {
+                failed = true;
+            }
+
+            assert(small.size() == static_cast<size_t>(n));
+            int small_sum = 0, count = 0;
+            for (auto it = small.begin(); it != small.end() && count <= n; ++it, ++count)
+                small_sum += *it;
+            assert(count == n && small_sum == n * (n + 1) / 2);
+            if (!failed)
+                break;
+        }
+    }
+}
+
+void test_merge() {
+    std::cout << "--- Running Merge Test ---\n";
+
+    nstd::list<int> a, b;
+    for (int x : {1, 4, 6, 9})
+        a.push_back(x);
+    for (int x : {2, 3, 6, 10, 11})
+        b.push_back(x);
+
+    const int* six_from_b = nullptr;
+    for (const auto& x : b)
+        if (x == 6)
+            six_from_b = &x;
+
+    a.merge(b);
+    assert(equals(a, {1, 2, 3, 4, 6, 6, 9, 10, 11}));
+    assert(b.empty());
+
+    // Equal elements from the argument come after ours.
+    auto it = a.begin();
+    for (int i = 0; i < 5; ++i)
+        ++it;
+    assert(&*it == six_from_b);
+
+    // Merging into an empty list, and with a comparator.
+    nstd::list<int> c;
+    c.merge(std::move(a));
+    assert(c.size() == 9 && a.empty());
+
+    nstd::list<int> d, e;
+    for (int x : {9, 5, 1})
+        d.push_back(x);
+    for (int x : {8, 2})
+        e.push_back(x);
+    d.merge(e, std::greater<>{});
+    assert(equals(d, {9, 8, 5, 2, 1}));
+    assert(d.back() == 1);
+}
+
+void test_unique_remove() {
+    std::cout << "--- Running Unique / Remove Test ---\n";
+
+    nstd::list<int> l;
+    for (int x : {1, 1, 2, 2, 2, 3, 1, 1, 4})
+        l.push_back(x);
+    assert(l.unique() == 4);
+    assert(equals(l, {1, 2, 3, 1, 4}));
+
+    // The predicate compares against the first element of each run.
+    nstd::list<int> close;
+    for (int x : {1, 2, 3, 4, 10, 11})
+        close.push_back(x);
+    assert(close.unique([](int first, int x) { return x - first <= 2; }) == 3);
+    assert(equals(close, {1, 4, 10}));
+
+    assert(l.remove_if([](int x) { return x % 2 == 1; }) == 3);
+    assert(equals(l, {2, 4}));
+    assert(l.front() == 2 && l.back() == 4);
+
+    // remove() with a reference into the list itself.
+    nstd::list<int> self;
+    for (int x : {7, 1, 7, 2, 7})
+        self.push_back(x);
+    assert(self.remove(self.front()) == 3);
+    assert(equals(self, {1, 2}));
+
+    assert(self.remove_if([](int) { return true; }) == 2);
+    assert(self.empty() && self.begin() == self.end());
+}
+
+// ------------------------- Queue Workload -------------------------
+// Milliseconds taken, and a checksum printed so the loop survives NDEBUG.
+template<typename List> std::pair<double, long long> run_queue_workload(int rounds) {
+    List queue;
+    long long checksum = 0;
+    const auto ms = time_ms([&] {
+        for (int r = 0; r < rounds; ++r) {
+            for (int i = 0; i < 64; ++i)
+                queue.push_back(i);
+            for (int i = 0; i < 64; ++i) {
+                checksum += queue.front();
+                queue.pop_front();
+            }
+        }
+    });
+    assert(checksum == static_cast<long long>(rounds) * (63 * 64 / 2));
+    return {ms, checksum};
+}
+
+void benchmark_queue_workload() {
+    std::cout << "[Benchmark] Queue Workload: Pooled vs Heap Nodes...\n";
+    constexpr int rounds = 20000;
+
+    using heap_list = nstd::list<int, std::allocator<int>>;
+    const auto [heap_ms, heap_sum] = run_queue_workload<heap_list>(rounds);
+    const auto [pool_ms, pool_sum] = run_queue_workload<nstd::list<int>>(rounds);
+
+    std::cout << "    std::allocator:       " << heap_ms << "ms (checksum " << heap_sum << ")\n";
+    std::cout << "    nstd::pool_allocator: " << pool_ms << "ms (checksum " << pool_sum << ")\n";
+}
+
+// Destroyed during exit, after this thread's node pool caches: its nodes go straight back to the
+// pool's depot.
+nstd::list<int> static_list;
+
+void test_static_storage_duration() {
+    std::cout << "[Test] List With Static Storage Duration... ";
+    for (int i = 0; i < 10; ++i) {
+        static_list.push_back(i);
+    }
+    assert(static_list.size() == 10 && static_list.back() == 9);
+    std::cout << "Passed.\n";
+}
 } // namespace list
 } // namespace tests
 
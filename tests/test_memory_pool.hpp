@@ -1,6 +1,9 @@
+#include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "nstd/memory_pool.hpp"
@@ -158,6 +161,412 @@ void test_small_object_correctness() {
     std::cout << "Passed.\n";
 }
 
+void test_lock_free_policy() {
+    std::cout << "[Test] Lock-Free Policy (single thread)... ";
+    nstd::memory_pool<int, 4, nstd::tagged_free_list> pool;
+
+    // Same LIFO behaviour as the default policy.
+    int* ptr1 = pool.allocate(42);
+    void* addr1 = ptr1;
+    pool.deallocate(ptr1);
+    int* ptr2 = pool.allocate(99);
+    assert(ptr2 == addr1);
+
+    // Expansion through the policy.
+    nstd::vector<int*> ptrs;
+    for (int i = 0; i < 20; ++i) {
+        ptrs.push_back(pool.allocate(i));
+    }
+    for (int i = 0; i < 20; ++i) {
+        assert(*ptrs[i] == i);
+        pool.deallocate(ptrs[i]);
+    }
+    pool.deallocate(ptr2);
+
+    std::cout << "Passed.\n";
+}
+
+void test_lock_free_policy_contention() {
+    std::cout << "[Test] Lock-Free Policy (4 threads)... ";
+
+    struct Payload {
+        size_t owner;
+        size_t seq;
+    };
+
+    nstd::memory_pool<Payload, 16, nstd::tagged_free_list> pool;
+    std::atomic<bool> corrupted{false};
+
+    auto worker = [&](size_t owner) {
+        Payload* held[8]{};
+        for (size_t round = 0; round < 20000; ++round) {
+            for (size_t i = 0; i < 8; ++i) {
+                held[i] = pool.allocate(Payload{owner, round * 8 + i});
+            }
+            for (size_t i = 0; i < 8; ++i) {
+                // Two threads handed the same block would overwrite each other here.
+                if (held[i]->owner != owner || held[i]->seq != round * 8 + i) {
+                    corrupted = true;
+                }
+                pool.deallocate(held[i]);
+            }
+        }
+    };
+
+    std::thread t1(worker, 1), t2(worker, 2), t3(worker, 3), t4(worker, 4);
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+
+    assert(!corrupted);
+    std::cout << "Passed.\n";
+}
+
+void test_geometric_growth() {
+    std::cout << "[Test] Geometric Chunk Growth... ";
+    nstd::memory_pool<int, 4> pool;
+    nstd::vector<int*> ptrs;
+
+    for (int i = 0; i < 1000; ++i) {
+        ptrs.push_back(pool.allocate(i));
+    }
+
+    // 4 + 4 + 8 + 16 + ... : a handful of chunks instead of 250 fixed ones.
+    assert(pool.capacity() >= 1000);
+    assert(pool.chunk_count() <= 10);
+
+    for (int i = 0; i < 1000; ++i) {
+        assert(*ptrs[i] == i);
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_chunk_reclamation() {
+    std::cout << "[Test] Free Chunks Are Returned... ";
+    nstd::memory_pool<size_t, 16> pool;
+    nstd::vector<size_t*> ptrs;
+
+    // Burst.
+    for (size_t i = 0; i < 100000; ++i) {
+        ptrs.push_back(pool.allocate(i));
+    }
+    const size_t peak_capacity = pool.capacity();
+
+    // Drain it again; trims kick in on the way down.
+    for (auto* p : ptrs) {
+        pool.deallocate(p);
+    }
+    assert(pool.capacity() < peak_capacity / 4);
+
+    // Explicit trim drops everything that is fully free.
+    pool.trim();
+    assert(pool.chunk_count() == 0 && pool.capacity() == 0);
+
+    // The pool is still usable.
+    size_t* p = pool.allocate(size_t{7});
+    assert(*p == 7);
+    pool.deallocate(p);
+
+    std::cout << "Passed.\n";
+}
+
+void test_reclamation_hysteresis() {
+    std::cout << "[Test] Reclamation Hysteresis... ";
+    nstd::memory_pool<int, 16> pool;
+    nstd::vector<int*> ptrs;
+
+    for (int i = 0; i < 5000; ++i) {
+        ptrs.push_back(pool.allocate(i));
+    }
+    for (int i = 0; i < 4000; ++i) {
+        pool.deallocate(ptrs.back());
+        ptrs.pop_back();
+    }
+
+    // Oscillating right at the current size must not grow or shrink the pool.
+    const size_t chunks = pool.chunk_count();
+    for (int round = 0; round < 1000; ++round) {
+        int* p = pool.allocate(round);
+        pool.deallocate(p);
+    }
+    assert(pool.chunk_count() == chunks);
+
+    for (auto* p : ptrs) {
+        pool.deallocate(p);
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_partially_used_chunks_survive() {
+    std::cout << "[Test] Trim Keeps Chunks With Live Blocks... ";
+    nstd::memory_pool<int, 8> pool;
+    nstd::vector<int*> ptrs;
+
+    for (int i = 0; i < 2000; ++i) {
+        ptrs.push_back(pool.allocate(i));
+    }
+
+    // Keep every 100th object alive, free everything else.
+    for (int i = 0; i < 2000; ++i) {
+        if (i % 100 != 0) {
+            pool.deallocate(ptrs[i]);
+        }
+    }
+    pool.trim();
+
+    for (int i = 0; i < 2000; i += 100) {
+        assert(*ptrs[i] == i);
+        pool.deallocate(ptrs[i]);
+    }
+
+    pool.trim();
+    assert(pool.chunk_count() == 0);
+
+    std::cout << "Passed.\n";
+}
+
+void test_release_all() {
+    std::cout << "[Test] release_all()... ";
+    nstd::memory_pool<size_t, 8> pool;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        pool.allocate(i);
+    }
+    const size_t capacity = pool.capacity();
+    const size_t chunks = pool.chunk_count();
+
+    pool.release_all();
+
+    // Everything is reusable without growing the pool.
+    nstd::vector<size_t*> ptrs;
+    for (size_t i = 0; i < 1000; ++i) {
+        ptrs.push_back(pool.allocate(i * 3));
+    }
+    assert(pool.capacity() == capacity);
+    assert(pool.chunk_count() == chunks);
+
+    for (size_t i = 0; i < 1000; ++i) {
+        assert(*ptrs[i] == i * 3);
+    }
+
+    pool.release_all();
+    pool.trim();
+    assert(pool.capacity() == 0);
+
+    std::cout << "Passed.\n";
+}
+
+struct alignas(32) Vec8f {
+    float lanes[8];
+};
+
+template<size_t Align> bool is_aligned(const void* ptr) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % Align == 0;
+}
+
+void test_over_aligned_type() {
+    std::cout << "[Test] Over-Aligned Types... ";
+    nstd::memory_pool<Vec8f, 7> pool;
+    nstd::vector<Vec8f*> ptrs;
+
+    // Enough to span several chunks, with an odd chunk size so block offsets would drift.
+    for (int i = 0; i < 100; ++i) {
+        ptrs.push_back(pool.allocate());
+        assert(is_aligned<alignof(Vec8f)>(ptrs.back()));
+        ptrs.back()->lanes[7] = static_cast<float>(i);
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        assert(ptrs[i]->lanes[7] == static_cast<float>(i));
+        pool.deallocate(ptrs[i]);
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_cache_line_padding() {
+    std::cout << "[Test] Cache Line Padded Blocks... ";
+    nstd::memory_pool<int, 16, nstd::intrusive_free_list, nstd::cache_line_size> pool;
+
+    int* a = pool.allocate(1);
+    int* b = pool.allocate(2);
+
+    // Neighbouring blocks sit on separate cache lines.
+    assert(is_aligned<nstd::cache_line_size>(a));
+    assert(is_aligned<nstd::cache_line_size>(b));
+    assert(reinterpret_cast<char*>(b) - reinterpret_cast<char*>(a) ==
+           static_cast<std::ptrdiff_t>(nstd::cache_line_size));
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+    std::cout << "Passed.\n";
+}
+
+void test_huge_page_chunks() {
+    std::cout << "[Test] Huge Page Backed Chunks... ";
+    constexpr size_t huge_page = nstd::huge_page_chunk_source::huge_page_size;
+
+    nstd::memory_pool<size_t, 16, nstd::intrusive_free_list, alignof(size_t),
+                      nstd::huge_page_chunk_source>
+        pool;
+
+    // The first chunk is rounded up to a whole huge page and filled with blocks.
+    assert(pool.capacity() == huge_page / sizeof(size_t));
+
+    const size_t count = 2 * pool.capacity();
+    nstd::vector<size_t*> ptrs;
+    for (size_t i = 0; i < count; ++i) {
+        ptrs.push_back(pool.allocate(i));
+    }
+    assert(is_aligned<huge_page>(ptrs.front()));
+
+    for (size_t i = 0; i < ptrs.size(); ++i) {
+        assert(*ptrs[i] == i);
+        pool.deallocate(ptrs[i]);
+    }
+    pool.trim();
+    assert(pool.chunk_count() == 0);
+
+    std::cout << "Passed.\n";
+}
+
+using debug_pool = nstd::memory_pool<size_t, 16, nstd::intrusive_free_list, alignof(size_t),
+                                     nstd::heap_chunk_source, nstd::pool_instrumentation>;
+
+// Records instrumentation reports instead of aborting.
+struct ReportLog {
+    static inline nstd::vector<nstd::pool_error> errors{};
+    static inline size_t leaked{};
+
+    static void record(nstd::pool_error error, const void*, size_t count) {
+        errors.push_back(error);
+        if (error == nstd::pool_error::leak) {
+            leaked = count;
+        }
+    }
+
+    ReportLog() {
+        errors.clear();
+        leaked = 0;
+        nstd::pool_instrumentation::handler = &record;
+    }
+
+    ~ReportLog() {
+        nstd::pool_instrumentation::handler = &nstd::pool_instrumentation::default_handler;
+    }
+};
+
+void test_instrumented_stats() {
+    std::cout << "[Test] Instrumented Pool Statistics... ";
+    ReportLog log;
+    debug_pool pool;
+    nstd::vector<size_t*> ptrs;
+
+    for (size_t i = 0; i < 40; ++i) {
+        ptrs.push_back(pool.allocate(i));
+    }
+    for (size_t i = 0; i < 30; ++i) {
+        pool.deallocate(ptrs[i]);
+    }
+
+    auto stats = pool.instrumentation().stats();
+    assert(stats.live == 10);
+    assert(stats.peak == 40);
+    assert(stats.allocations == 40);
+    assert(stats.deallocations == 30);
+    assert(stats.chunks == pool.chunk_count());
+
+    // Freed blocks are poisoned past the embedded next pointer.
+    struct Wide {
+        size_t words[4];
+    };
+    nstd::memory_pool<Wide, 16, nstd::intrusive_free_list, alignof(Wide), nstd::heap_chunk_source,
+                      nstd::pool_instrumentation>
+        wide_pool;
+    Wide* w = wide_pool.allocate(Wide{{1, 2, 3, 4}});
+    wide_pool.deallocate(w);
+    const auto* bytes = reinterpret_cast<const unsigned char*>(w);
+    assert(bytes[sizeof(Wide) - 1] == nstd::pool_instrumentation::poison_byte);
+
+    for (size_t i = 30; i < 40; ++i) {
+        pool.deallocate(ptrs[i]);
+    }
+    assert(log.errors.is_empty());
+
+    std::cout << "Passed.\n";
+}
+
+void test_instrumented_double_free() {
+    std::cout << "[Test] Double Free / Foreign Pointer Detection... ";
+    ReportLog log;
+    debug_pool pool;
+
+    size_t* p = pool.allocate(1);
+    pool.deallocate(p);
+    pool.deallocate(p);
+    assert(log.errors.size() == 1 && log.errors[0] == nstd::pool_error::double_free);
+
+    size_t outsider = 0;
+    pool.deallocate(&outsider);
+    assert(log.errors.size() == 2 && log.errors[1] == nstd::pool_error::foreign_pointer);
+
+    // The rejected frees did not corrupt the free list: the block comes back exactly once.
+    size_t* a = pool.allocate(2);
+    size_t* b = pool.allocate(3);
+    assert(a == p && b != p);
+    pool.deallocate(a);
+    pool.deallocate(b);
+    assert(log.errors.size() == 2);
+
+    std::cout << "Passed.\n";
+}
+
+void test_instrumented_use_after_free() {
+    std::cout << "[Test] Use-After-Free Detection... ";
+    ReportLog log;
+
+    struct Pair {
+        size_t first;
+        size_t second;
+    };
+    nstd::memory_pool<Pair, 16, nstd::intrusive_free_list, alignof(Pair), nstd::heap_chunk_source,
+                      nstd::pool_instrumentation>
+        pool;
+
+    Pair* p = pool.allocate(Pair{1, 2});
+    pool.deallocate(p);
+    p->second = 42; // stale write into a free block
+
+    // The free list is LIFO, so the damaged block is the next one handed out.
+    Pair* q = pool.allocate(Pair{3, 4});
+    assert(q == p);
+    assert(log.errors.size() == 1 && log.errors[0] == nstd::pool_error::use_after_free);
+
+    pool.deallocate(q);
+    std::cout << "Passed.\n";
+}
+
+void test_instrumented_leak_report() {
+    std::cout << "[Test] Leak Report at Destruction... ";
+    ReportLog log;
+
+    {
+        debug_pool pool;
+        pool.allocate(1);
+        pool.allocate(2);
+        size_t* freed = pool.allocate(3);
+        pool.deallocate(freed);
+    }
+
+    assert(log.errors.size() == 1 && log.errors[0] == nstd::pool_error::leak);
+    assert(log.leaked == 2);
+
+    std::cout << "Passed.\n";
+}
+
 void run_all_tests() {
     std::cout << "=== Running Memory Pool Tests ===\n";
 
@@ -167,6 +576,20 @@ void run_all_tests() {
     test_complex_types();
     test_destructor_call();
     test_small_object_correctness();
+    test_lock_free_policy();
+    test_lock_free_policy_contention();
+    test_geometric_growth();
+    test_chunk_reclamation();
+    test_reclamation_hysteresis();
+    test_partially_used_chunks_survive();
+    test_release_all();
+    test_over_aligned_type();
+    test_cache_line_padding();
+    test_huge_page_chunks();
+    test_instrumented_stats();
+    test_instrumented_double_free();
+    test_instrumented_use_after_free();
+    test_instrumented_leak_report();
 
     std::cout << "=== All Tests Passed ===\n";
 }
@@ -0,0 +1,290 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "nstd/rope.hpp"
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+
+namespace tests {
+namespace rope {
+
+nstd::string_view as_view(const std::string& str) {
+    return {str.data(), str.size()};
+}
+
+// Leaves are non-empty and within capacity, sizes add up, and sibling heights differ by one at
+// most.
+void check_structure(const nstd::rope& r) {
+    size_t total = 0;
+    size_t leaves = 0;
+    for (auto chunk : r.chunks()) {
+        assert(!chunk.empty() && chunk.size() <= nstd::rope::leaf_capacity);
+        total += chunk.size();
+        ++leaves;
+    }
+    assert(total == r.size());
+    if (leaves > 1) {
+        assert(r.height() <= 1.45 * std::log2(static_cast<double>(leaves)) + 2);
+    }
+}
+
+void test_basics() {
+    std::cout << "[Test] Construction / Access / Edits... ";
+    nstd::rope empty;
+    assert(empty.empty() && empty.size() == 0 && empty.begin() == empty.end());
+    assert(empty.chunks().begin() == empty.chunks().end());
+    assert(empty == "" && empty.str().empty());
+
+    nstd::rope text{"hello world"};
+    assert(text.size() == 11 && text[0] == 'h' && text.at(10) == 'd');
+    assert(text == "hello world" && text.height() == 0);
+
+    text.insert(5, ",");
+    text.insert(text.size(), "!");
+    text.insert(0, ">> ");
+    assert(text == ">> hello, world!");
+
+    text.erase(0, 3);
+    text.erase(5, 1);
+    assert(text == "hello world!");
+    text.erase(5);
+    assert(text == "hello");
+
+    text += " again";
+    text += nstd::rope{"!"};
+    assert(text.str() == nstd::string("hello again!"));
+    assert(text.substr(6, 5) == "again" && text.substr(6) == "again!");
+
+    bool threw = false;
+    try {
+        text.at(12);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    threw = false;
+    try {
+        text.insert(13, "x");
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    text.clear();
+    assert(text.empty());
+
+    std::cout << "Passed.\n";
+}
+
+void test_large_text() {
+    std::cout << "[Test] Large Text / Chunks... ";
+    std::string source;
+    for (int i = 0; i < 20000; ++i) {
+        source += "line " + std::to_string(i) + "\n";
+    }
+
+    nstd::rope doc{as_view(source)};
+    assert(doc.size() == source.size() && doc == as_view(source));
+    assert(doc.height() > 0);
+    check_structure(doc);
+
+    // Chunks are contiguous spans, in order, that cover the text exactly.
+    size_t offset = 0;
+    for (auto it = doc.chunks().begin(); it != doc.chunks().end(); ++it) {
+        assert(it.offset() == offset);
+        assert(*it == as_view(source).substr(offset, it->size()));
+        offset += it->size();
+    }
+    assert(offset == source.size());
+
+    // Character iteration and indexing agree with the source.
+    size_t index = 0;
+    for (char ch : doc) {
+        assert(ch == source[index++]);
+    }
+    assert(index == source.size());
+    for (size_t pos = 0; pos < source.size(); pos += 997) {
+        assert(doc[pos] == source[pos]);
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_sharing() {
+    std::cout << "[Test] Snapshots / Shared Structure... ";
+    std::string source(50000, 'x');
+    for (size_t i = 0; i < source.size(); ++i) {
+        source[i] = static_cast<char>('a' + i % 26);
+    }
+    const nstd::rope original{as_view(source)};
+
+    // A copy is a snapshot: editing it leaves the original intact.
+    nstd::rope edited{original};
+    edited.insert(25000, "INSERTED");
+    edited.erase(0, 100);
+    assert(original == as_view(source));
+    assert(edited.size() == source.size() - 100 + 8);
+    assert(edited.substr(24900, 8) == "INSERTED");
+
+    // Untouched leaves are shared, not copied: they have the same addresses in both ropes.
+    const auto first_leaf = original.chunks().begin();
+    auto tail = edited.substr(30000);
+    size_t shared = 0;
+    for (auto chunk : tail.chunks()) {
+        for (auto candidate : original.chunks()) {
+            shared += chunk.data() == candidate.data();
+        }
+    }
+    assert(shared > 0);
+    assert(first_leaf->data() == original.chunks().begin()->data());
+
+    // Concatenation shares both operands.
+    auto doubled = original + original;
+    assert(doubled.size() == 2 * source.size());
+    assert(doubled.substr(source.size()) == as_view(source));
+    check_structure(doubled);
+
+    // Snapshots may be read and edited from several threads.
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&original, &source, t] {
+            for (int i = 0; i < 200; ++i) {
+                nstd::rope local{original};
+                local.insert(static_cast<size_t>(t * 1000 + i), "t");
+                assert(local.size() == source.size() + 1);
+                assert(local[static_cast<size_t>(t * 1000 + i)] == 't');
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    assert(original == as_view(source));
+
+    std::cout << "Passed.\n";
+}
+
+void test_random_edits() {
+    std::cout << "[Test] Random Edits vs std::string... ";
+    std::mt19937 rng(45);
+    std::string expected;
+    nstd::rope actual;
+
+    auto random_text = [&](size_t length) {
+        std::string text(length, 'a');
+        for (auto& ch : text) {
+            ch = static_cast<char>('a' + rng() % 26);
+        }
+        return text;
+    };
+
+    for (int round = 0; round < 4000; ++round) {
+        const auto pos = rng() % (expected.size() + 1);
+        switch (rng() % 6) {
+        case 0:
+        case 1: {
+            // Mostly small edits, sometimes spanning several leaves.
+            const auto text = random_text(rng() % 8 == 0 ? rng() % 3000 : rng() % 20);
+            expected.insert(pos, text);
+            actual.insert(pos, as_view(text));
+            break;
+        }
+        case 2: {
+            const auto count = rng() % 8 == 0 ? rng() % 4000 : rng() % 20;
+            expected.erase(pos, count);
+            actual.erase(pos, count);
+            break;
+        }
+        case 3: {
+            const auto count = rng() % (expected.size() - pos + 1);
+            const auto piece = actual.substr(pos, count);
+            assert(piece == as_view(expected.substr(pos, count)));
+            check_structure(piece);
+            break;
+        }
+        case 4: {
+            // Insert a slice of the rope into itself.
+            const auto count = rng() % 2000;
+            const auto piece = actual.substr(pos, count);
+            const auto at = rng() % (expected.size() + 1);
+            expected.insert(at, expected.substr(pos, count));
+            actual.insert(at, piece);
+            break;
+        }
+        default: {
+            const auto text = random_text(rng() % 500);
+            expected += text;
+            actual += nstd::rope{as_view(text)};
+            break;
+        }
+        }
+
+        if (expected.size() > 200000) {
+            expected.erase(0, 100000);
+            actual.erase(0, 100000);
+        }
+        assert(actual.size() == expected.size());
+        if (round % 50 == 0) {
+            assert(actual == as_view(expected));
+            check_structure(actual);
+        }
+    }
+    assert(actual == as_view(expected));
+    check_structure(actual);
+
+    std::cout << "Passed.\n";
+}
+
+void benchmark_editing() {
+    std::cout << "[Benchmark] Mid-Document Edits vs std::string...\n";
+    std::string source;
+    for (int i = 0; i < 400000; ++i) {
+        source += "word" + std::to_string(i % 100) + " ";
+    }
+    constexpr int edits = 20000;
+
+    // Insert and erase a word at pseudo-random positions, as an editor would. The flat baseline
+    // moves the tail of the buffer on every edit.
+    std::string flat{source};
+    nstd::rope doc{as_view(source)};
+    auto flat_ms = time_ms([&] {
+        std::mt19937 rng(7);
+        for (int i = 0; i < edits; ++i) {
+            flat.insert(rng() % flat.size(), "edit ");
+            flat.erase(rng() % (flat.size() - 5), 5);
+        }
+    });
+    auto rope_ms = time_ms([&] {
+        std::mt19937 rng(7);
+        for (int i = 0; i < edits; ++i) {
+            doc.insert(rng() % doc.size(), "edit ");
+            doc.erase(rng() % (doc.size() - 5), 5);
+        }
+    });
+    assert(doc.size() == flat.size() && doc == as_view(flat));
+
+    std::cout << "    std::string: " << flat_ms << "ms\n";
+    std::cout << "    nstd::rope:  " << rope_ms << "ms (" << source.size() / 1024 << " KiB, "
+              << 2 * edits << " edits)\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running Rope Tests ===\n";
+
+    test_basics();
+    test_large_text();
+    test_sharing();
+    test_random_edits();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace rope
+} // namespace tests
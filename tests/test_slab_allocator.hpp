@@ -0,0 +1,156 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "nstd/slab_allocator.hpp"
+
+namespace tests {
+namespace slab_allocator {
+
+void test_size_classes() {
+    std::cout << "[Test] Size Class Rounding... ";
+
+    static_assert(nstd::slab_resource::class_count == 9);
+    static_assert(nstd::slab_resource::block_size_for(1) == 16);
+    static_assert(nstd::slab_resource::block_size_for(16) == 16);
+    static_assert(nstd::slab_resource::block_size_for(17) == 32);
+    static_assert(nstd::slab_resource::block_size_for(100) == 128);
+    static_assert(nstd::slab_resource::block_size_for(4096) == 4096);
+    static_assert(nstd::slab_resource::block_size_for(5000) == 5000);
+
+    std::cout << "Passed.\n";
+}
+
+void test_allocate_all_classes() {
+    std::cout << "[Test] Allocate / Deallocate Every Class... ";
+    nstd::slab_resource slab;
+    constexpr size_t align = alignof(std::max_align_t);
+
+    for (size_t bytes = 1; bytes <= 8192; bytes = bytes * 2 + 1) {
+        auto* p = static_cast<unsigned char*>(slab.allocate(bytes, align));
+        assert(p);
+        assert(reinterpret_cast<std::uintptr_t>(p) % align == 0);
+
+        // The whole request must be writable.
+        std::memset(p, 0xAB, bytes);
+        assert(p[bytes - 1] == 0xAB);
+
+        slab.deallocate(p, bytes, align);
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_block_reuse() {
+    std::cout << "[Test] Same Class Reuses Blocks... ";
+    nstd::slab_resource slab;
+    constexpr size_t align = alignof(std::max_align_t);
+
+    void* a = slab.allocate(40, align);
+    slab.deallocate(a, 40, align);
+
+    // 33..64 bytes all land in the 64-byte class, so the freed block comes straight back.
+    void* b = slab.allocate(64, align);
+    assert(a == b);
+
+    // Different class, different block.
+    void* c = slab.allocate(20, align);
+    assert(c != b);
+
+    slab.deallocate(b, 64, align);
+    slab.deallocate(c, 20, align);
+
+    std::cout << "Passed.\n";
+}
+
+void test_default_new_alignment() {
+    std::cout << "[Test] Default-New Alignment From Every Class... ";
+    nstd::slab_resource slab;
+    constexpr size_t align = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    // Several blocks per class, so consecutive blocks of a chunk are checked, not only the first.
+    std::vector<std::pair<void*, size_t>> blocks;
+    for (size_t bytes = 1; bytes <= nstd::slab_resource::max_block_size; bytes *= 2) {
+        for (int i = 0; i < 5; ++i) {
+            void* p = slab.allocate(bytes, align);
+            assert(reinterpret_cast<std::uintptr_t>(p) % align == 0);
+            blocks.emplace_back(p, bytes);
+        }
+    }
+    for (auto [p, bytes] : blocks) {
+        slab.deallocate(p, bytes, align);
+    }
+
+    std::cout << "Passed.\n";
+}
+
+// Without the alignment, deallocate() could send an over-aligned block to a size-class pool.
+template<typename Resource>
+concept frees_without_alignment = requires(Resource& resource, void* ptr) {
+    resource.deallocate(ptr, size_t{64});
+};
+
+void test_over_aligned() {
+    std::cout << "[Test] Over-Aligned Requests... ";
+    static_assert(!frees_without_alignment<nstd::slab_resource>);
+    nstd::slab_resource slab;
+
+    void* p = slab.allocate(64, 256);
+    assert(reinterpret_cast<std::uintptr_t>(p) % 256 == 0);
+    slab.deallocate(p, 64, 256);
+
+    std::cout << "Passed.\n";
+}
+
+void test_std_containers() {
+    std::cout << "[Test] Standard Allocator Requirements... ";
+    nstd::slab_resource slab;
+
+    {
+        std::vector<int, nstd::slab_allocator<int>> v{nstd::slab_allocator<int>{slab}};
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+        for (int i = 0; i < 1000; ++i) {
+            assert(v[i] == i);
+        }
+    }
+
+    {
+        // std::list rebinds the allocator to its node type.
+        std::list<double, nstd::slab_allocator<double>> l{nstd::slab_allocator<double>{slab}};
+        for (int i = 0; i < 100; ++i) {
+            l.push_back(i * 0.5);
+        }
+        assert(l.size() == 100);
+        assert(l.back() == 49.5);
+    }
+
+    nstd::slab_allocator<int> a{slab};
+    nstd::slab_allocator<long> b{a};
+    assert(a == b);
+
+    nstd::slab_resource other;
+    assert(!(a == nstd::slab_allocator<int>{other}));
+
+    std::cout << "Passed.\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running Slab Allocator Tests ===\n";
+
+    test_size_classes();
+    test_allocate_all_classes();
+    test_block_reuse();
+    test_default_new_alignment();
+    test_over_aligned();
+    test_std_containers();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace slab_allocator
+} // namespace tests
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "nstd/split.hpp"
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+
+namespace tests {
+namespace split {
+
+// The ranges are C++20 views that can be used at compile time.
+static_assert(std::ranges::forward_range<nstd::split_view<char, char>>);
+static_assert(std::ranges::view<nstd::split_view<char, nstd::string_view>>);
+static_assert(std::ranges::common_range<nstd::split_view<char, char>>);
+static_assert(std::ranges::borrowed_range<nstd::split_view<char, char>>);
+static_assert(std::ranges::forward_range<nstd::tokenize_view<char>>);
+static_assert(std::ranges::view<nstd::tokenize_view<char>>);
+static_assert(std::ranges::distance(nstd::split(nstd::string_view{"a,b,,c"}, ',')) == 4);
+static_assert(*nstd::tokenize(nstd::string_view{"  key = value"}, " =").begin() == "key");
+
+template<typename Range> std::vector<nstd::string_view> collect(Range&& range) {
+    std::vector<nstd::string_view> out;
+    for (auto piece : range) {
+        out.push_back(piece);
+    }
+    return out;
+}
+
+void test_split() {
+    std::cout << "[Test] split()... ";
+    using fields = std::vector<nstd::string_view>;
+
+    assert(collect(nstd::split(nstd::string_view{"a,b,c"}, ',')) == (fields{"a", "b", "c"}));
+    assert(collect(nstd::split(nstd::string_view{"a,,b,"}, ',')) == (fields{"a", "", "b", ""}));
+    assert(collect(nstd::split(nstd::string_view{",a"}, ',')) == (fields{"", "a"}));
+    assert(collect(nstd::split(nstd::string_view{"abc"}, ',')) == (fields{"abc"}));
+    assert(collect(nstd::split(nstd::string_view{""}, ',')) == (fields{""}));
+
+    // Multi-character delimiters.
+    assert(collect(nstd::split(nstd::string_view{"GET / HTTP/1.1\r\nHost: x\r\n\r\n"}, "\r\n")) ==
+           (fields{"GET / HTTP/1.1", "Host: x", "", ""}));
+    assert(collect(nstd::split(nstd::string_view{"a::b:c::"}, "::")) == (fields{"a", "b:c", ""}));
+
+    // Fields are views into the original string.
+    const nstd::string line{"id=7;name=nstd;tags=fast,small"};
+    for (auto field : nstd::split(line, ';')) {
+        assert(field.data() >= line.data());
+        assert(field.data() + field.size() <= line.data() + line.size());
+    }
+    assert(collect(nstd::split(line, ";")) == (fields{"id=7", "name=nstd", "tags=fast,small"}));
+
+    // Other character types.
+    const nstd::basic_string<char16_t> wide{u"x|y|z"};
+    auto wide_fields = nstd::split(wide, u'|');
+    assert(std::ranges::distance(wide_fields) == 3 && *std::next(wide_fields.begin()) == u"y");
+
+    std::cout << "Passed.\n";
+}
+
+void test_tokenize() {
+    std::cout << "[Test] tokenize()... ";
+    using tokens = std::vector<nstd::string_view>;
+
+    assert(collect(nstd::tokenize(nstd::string_view{"  the quick\t\tbrown  fox \n"}, " \t\n")) ==
+           (tokens{"the", "quick", "brown", "fox"}));
+    assert(collect(nstd::tokenize(nstd::string_view{"word"}, " ")) == (tokens{"word"}));
+    assert(collect(nstd::tokenize(nstd::string_view{"   "}, " ")).empty());
+    assert(collect(nstd::tokenize(nstd::string_view{""}, " ")).empty());
+
+    const nstd::string expr{"(a+b)*c - d/e"};
+    assert(collect(nstd::tokenize(expr, "()+-*/ ")) == (tokens{"a", "b", "c", "d", "e"}));
+
+    std::cout << "Passed.\n";
+}
+
+void test_ranges_interop() {
+    std::cout << "[Test] std::ranges Interop... ";
+    const nstd::string csv{"3,14,15,92,65"};
+
+    auto fields = nstd::split(csv, ',');
+    assert(!fields.empty() && fields.front() == "3");
+    assert(std::ranges::count_if(fields, [](auto field) { return field.size() == 2; }) == 4);
+
+    auto to_int = [](nstd::string_view field) {
+        int value = 0;
+        for (char ch : field) {
+            value = value * 10 + (ch - '0');
+        }
+        return value;
+    };
+    int sum = 0;
+    for (int value : fields | std::views::transform(to_int) | std::views::take(3)) {
+        sum += value;
+    }
+    assert(sum == 32);
+
+    // Borrowed: iterators stay valid after the range object is gone.
+    auto it = std::ranges::find(nstd::split(csv, ','), nstd::string_view{"92"});
+    assert(*it == "92" && *++it == "65");
+
+    auto words = nstd::tokenize(nstd::string_view{"b a c"}, " ");
+    std::vector<nstd::string_view> sorted(words.begin(), words.end());
+    std::ranges::sort(sorted);
+    assert(sorted.front() == "a" && sorted.back() == "c");
+
+    std::cout << "Passed.\n";
+}
+
+void benchmark_csv() {
+    std::cout << "[Benchmark] CSV Parsing vs vector<string> per Line...\n";
+    std::mt19937 rng(48);
+    std::string file;
+    for (int row = 0; row < 200000; ++row) {
+        file += std::to_string(row) + ",user" + std::to_string(rng() % 10000) + "," +
+                std::to_string(rng() % 100000) + ".25,active,2024-05-" +
+                std::to_string(1 + rng() % 28) + ",/api/v1/items/" + std::to_string(rng()) + "\n";
+    }
+    const nstd::string_view text{file.data(), file.size()};
+
+    // Baseline: materialise each line as a vector of owning strings.
+    size_t eager_sum = 0;
+    const auto eager_ms = time_ms([&] {
+        size_t start = 0;
+        while (start < file.size()) {
+            const auto stop = file.find('\n', start);
+            std::vector<std::string> row;
+            size_t field_start = start;
+            for (size_t pos = start; pos <= stop; ++pos) {
+                if (pos == stop || file[pos] == ',') {
+                    row.emplace_back(file, field_start, pos - field_start);
+                    field_start = pos + 1;
+                }
+            }
+            eager_sum += row.size() + row[1].size();
+            start = stop + 1;
+        }
+    });
+
+    size_t lazy_sum = 0;
+    const auto lazy_ms = time_ms([&] {
+        for (auto line : nstd::split(text, '\n')) {
+            if (line.empty()) {
+                continue;
+            }
+            size_t columns = 0;
+            for (auto field : nstd::split(line, ',')) {
+                lazy_sum += columns++ == 1 ? field.size() : 0;
+            }
+            lazy_sum += columns;
+        }
+    });
+    assert(eager_sum == lazy_sum);
+
+    std::cout << "    vector<string> per line: " << eager_ms << "ms\n";
+    std::cout << "    nstd::split:             " << lazy_ms << "ms (" << file.size() / (1024 * 1024)
+              << " MiB, checksum " << lazy_sum << ")\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running Split Tests ===\n";
+
+    test_split();
+    test_tokenize();
+    test_ranges_interop();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace split
+} // namespace tests
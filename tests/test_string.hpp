@@ -1,11 +1,13 @@
 #ifndef TESTS_STRING_HPP
 #define TESTS_STRING_HPP
 
+#include "nstd/arena.hpp"
 #include "nstd/string.hpp"
 #include "nstd/vector.hpp"
 #include <cassert>
 #include <chrono>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -411,6 +413,79 @@ void test_swap() {
     assert(s2.size() == 5);
 }
 
+// ------------------------- Allocator Propagation Tests -------------------------
+// Stateful allocator that never propagates on move assignment.
+template<typename T> struct PinnedAlloc {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+
+    int id;
+
+    explicit PinnedAlloc(int i) : id(i) {}
+    template<typename U> PinnedAlloc(const PinnedAlloc<U>& other) : id(other.id) {}
+
+    T* allocate(size_t n) {
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(const PinnedAlloc& a, const PinnedAlloc& b) {
+        return a.id == b.id;
+    }
+};
+
+void test_allocator_propagation() {
+    std::cout << "--- Running Allocator Propagation Tests ---\n";
+    using arena_string = nstd::basic_string<char, nstd::arena_allocator<char>>;
+
+    nstd::inline_arena<4096> a1;
+    nstd::inline_arena<4096> a2;
+    auto in = [](const nstd::arena& arena, const arena_string& str) {
+        const auto* first = reinterpret_cast<const char*>(&arena);
+        return str.data() >= first && str.data() < first + sizeof(nstd::inline_arena<4096>);
+    };
+    const char* long_text = "a string that is too long for the inline buffer";
+
+    // Copy assignment does not propagate: x keeps its arena and copies the characters into it.
+    arena_string x(long_text, nstd::arena_allocator<char>{a1});
+    arena_string y("another string, which lives in the second arena",
+                   nstd::arena_allocator<char>{a2});
+    x = y;
+    assert(x == y && x.get_allocator().source() == &a1 && in(a1, x));
+    arena_string longer("and a third one, longer than both of the strings above it",
+                        nstd::arena_allocator<char>{a2});
+    x = longer;
+    assert(x == longer && x.get_allocator().source() == &a1 && in(a1, x));
+
+    // Move assignment propagates: the buffer is adopted together with its allocator.
+    arena_string z(long_text, nstd::arena_allocator<char>{a1});
+    const char* buffer = y.data();
+    z = std::move(y);
+    assert(z.data() == buffer && z.get_allocator().source() == &a2 && y.empty());
+
+    // So does swap.
+    swap(x, z);
+    assert(x.get_allocator().source() == &a2 && z.get_allocator().source() == &a1);
+    assert(in(a1, z) && in(a2, x));
+
+    // Without propagation a move between unequal allocators copies.
+    using pinned_string = nstd::basic_string<char, PinnedAlloc<char>>;
+    pinned_string p(long_text, PinnedAlloc<char>{1});
+    pinned_string q("a heap string owned by the second allocator", PinnedAlloc<char>{2});
+    const char* q_buffer = q.data();
+    p = std::move(q);
+    assert(p.get_allocator().id == 1 && p.data() != q_buffer);
+    assert(nstd::string_view(p) == "a heap string owned by the second allocator");
+
+    pinned_string r(long_text, PinnedAlloc<char>{1});
+    const char* r_buffer = r.data();
+    p = std::move(r);
+    assert(p.data() == r_buffer && r.empty());
+}
+
 // ------------------------- Exception Safety Tests -------------------------
 void test_exception_safety() {
     std::cout << "--- Running Exception Safety Tests ---\n";
@@ -465,6 +540,168 @@ void test_stress() {
     assert(s3.size() == 0);
 }
 
+// ------------------------- Small String Tests -------------------------
+struct AllocationCounter {
+    static inline size_t allocations{};
+};
+
+template<typename T> struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template<typename U> counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(size_t n) {
+        ++AllocationCounter::allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    friend bool operator==(const counting_allocator&, const counting_allocator&) {
+        return true;
+    }
+};
+
+void test_small_string() {
+    std::cout << "--- Running Small String Tests ---\n";
+    using counted_string = nstd::basic_string<char, counting_allocator<char>>;
+
+    if constexpr (sizeof(void*) == 8) {
+        static_assert(sizeof(nstd::string) == 24);
+        static_assert(nstd::string::inline_capacity == 22);
+    }
+
+    auto inside = [](const auto& s) {
+        auto* begin = reinterpret_cast<const char*>(&s);
+        auto* data = reinterpret_cast<const char*>(s.data());
+        return data >= begin && data < begin + sizeof(s);
+    };
+
+    AllocationCounter::allocations = 0;
+
+    // Default construction, short strings and their copies and moves stay inline.
+    counted_string empty;
+    assert(empty.empty() && empty.c_str()[0] == '\0');
+    assert(empty.capacity() == counted_string::inline_capacity);
+
+    counted_string key("session:4f2a9c");
+    counted_string copy(key);
+    counted_string moved(std::move(copy));
+    assert(moved == key && inside(moved));
+    assert(copy.empty() && copy.c_str()[0] == '\0');
+
+    const std::string longest(counted_string::inline_capacity, 'k');
+    counted_string full(longest.c_str());
+    assert(full.size() == longest.size() && inside(full));
+    assert(std::string(full.c_str()) == longest);
+    assert(AllocationCounter::allocations == 0);
+
+    // One more character moves the string to the heap.
+    full.push_back('!');
+    assert(AllocationCounter::allocations == 1 && !inside(full));
+    assert(std::string(full.c_str()) == longest + "!");
+    assert(full.capacity() >= full.size());
+
+    // Moving a heap string steals its buffer.
+    const char* buffer = full.data();
+    counted_string stolen(std::move(full));
+    assert(stolen.data() == buffer && full.empty() && inside(full));
+
+    counted_string assigned;
+    assigned = std::move(stolen);
+    assert(assigned.data() == buffer && AllocationCounter::allocations == 1);
+
+    // Swapping an inline and a heap string.
+    swap(assigned, key);
+    assert(key.data() == buffer && inside(assigned));
+    assert(std::string(assigned.c_str()) == "session:4f2a9c");
+    assert(AllocationCounter::allocations == 1);
+
+    // Growing inside the inline buffer does not allocate either.
+    counted_string grown;
+    for (size_t i = 0; i < counted_string::inline_capacity; ++i) {
+        grown.push_back(static_cast<char>('a' + i % 26));
+    }
+    grown.pop_back();
+    grown += "z";
+    assert(grown.size() == counted_string::inline_capacity);
+    assert(AllocationCounter::allocations == 1);
+
+    // Assigning a C string reuses whatever buffer is there.
+    key = "short";
+    assert(key.data() == buffer && std::string(key.c_str()) == "short");
+    assert(AllocationCounter::allocations == 1);
+
+    // Wider character types get a smaller inline buffer in the same footprint.
+    nstd::basic_string<char32_t> wide(U"wide");
+    assert(wide.size() == 4 && wide.capacity() == nstd::basic_string<char32_t>::inline_capacity);
+    static_assert(sizeof(nstd::basic_string<char32_t>) == sizeof(nstd::string));
+    wide.push_back(U'!');
+    assert(wide.size() == 5 && wide[4] == U'!' && wide[5] == U'\0');
+}
+
+// ------------------------- Append / Growth Tests -------------------------
+void test_append_growth() {
+    std::cout << "--- Running Append / Growth Tests ---\n";
+    using counted_string = nstd::basic_string<char, counting_allocator<char>>;
+
+    // Sized append keeps embedded nulls and only the requested prefix.
+    nstd::string s("key");
+    s.append("=va\0lue-ignored", 7);
+    assert(s.size() == 10 && s[6] == '\0' && s[9] == 'e' && s.c_str()[10] == '\0');
+
+    nstd::string other("|tail");
+    s.append(other);
+    s += other;
+    assert(s.size() == 20);
+    assert(std::string(s.data(), s.size()) == std::string("key=va\0lue|tail|tail", 20));
+
+    // Appending a string, or a piece of it, to itself.
+    nstd::string self("abcdefghijklmnop");
+    self.append(self);
+    assert(std::string(self.c_str()) == "abcdefghijklmnopabcdefghijklmnop");
+    self.append(self.data() + 4, 4);
+    assert(std::string(self.c_str()) == "abcdefghijklmnopabcdefghijklmnopefgh");
+    self += self;
+    assert(self.size() == 72);
+    assert(std::string(self.c_str()).substr(36) == std::string(self.c_str()).substr(0, 36));
+
+    // A long chain of appends reallocates only logarithmically often.
+    AllocationCounter::allocations = 0;
+    counted_string chain;
+    counted_string piece("0123456789");
+    for (int i = 0; i < 10000; ++i) {
+        chain += piece;
+    }
+    for (int i = 0; i < 10000; ++i) {
+        chain.push_back('x');
+    }
+    assert(chain.size() == 110000);
+    assert(AllocationCounter::allocations <= 16);
+
+    // Requests past max_size() throw instead of overflowing.
+    assert(throws_exception([&]() { s.reserve(s.max_size() + 1); }));
+    assert(throws_exception([&]() { s.append("x", std::numeric_limits<size_t>::max()); }));
+    assert(s.size() == 20);
+
+    // resize_and_overwrite writes straight into the buffer.
+    nstd::string formatted("id=");
+    formatted.resize_and_overwrite(64, [](char* data, size_t capacity) {
+        assert(capacity == 64 && data[0] == 'i' && data[2] == '=');
+        const char digits[] = "1234567890";
+        std::copy(digits, digits + 10, data + 3);
+        return size_t{13};
+    });
+    assert(formatted.size() == 13 && std::string(formatted.c_str()) == "id=1234567890");
+    assert(formatted.capacity() >= 64);
+
+    formatted.resize_and_overwrite(2, [](char*, size_t) { return 2; });
+    assert(std::string(formatted.c_str()) == "id");
+}
+
 // ------------------------- Type Alias Tests -------------------------
 void test_type_aliases() {
     std::cout << "--- Running Type Alias Tests ---\n";
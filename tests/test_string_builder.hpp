@@ -0,0 +1,191 @@
+#include <cassert>
+#include <charconv>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "benchmark.hpp"
+#include "nstd/string.hpp"
+#include "nstd/string_builder.hpp"
+#include "nstd/string_view.hpp"
+
+namespace tests {
+namespace string_builder {
+
+struct AllocationCounter {
+    static inline size_t allocations{};
+};
+
+template<typename T> struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template<typename U> counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(size_t n) {
+        ++AllocationCounter::allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    friend bool operator==(const counting_allocator&, const counting_allocator&) {
+        return true;
+    }
+};
+
+using counted_builder = nstd::basic_string_builder<64, counting_allocator<char>>;
+
+void test_append() {
+    std::cout << "[Test] Append / Formatting... ";
+    nstd::string_builder builder;
+    assert(builder.empty() && builder.is_inline() && builder.capacity() == 512);
+
+    builder << "user=" << nstd::string_view{"alice"} << ' ' << "id=" << 42 << " ok=" << true;
+    assert(builder.view() == "user=alice id=42 ok=true");
+
+    builder.clear();
+    builder << -7 << ',' << std::int8_t{-128} << ',' << std::uint64_t{18446744073709551615u} << ','
+            << std::numeric_limits<long long>::min();
+    assert(builder.view() == "-7,-128,18446744073709551615,-9223372036854775808");
+
+    builder.clear();
+    builder.append_integer(255, 16).append(',').append_integer(5, 2).append(size_t{3}, '-');
+    assert(builder.view() == "ff,101---");
+
+    // Floating point: shortest round-trip form by default, or an explicit format.
+    builder.clear();
+    builder << 0.1 << ' ' << 1.5f << ' ' << 1e300 << ' ' << -0.0;
+    assert(builder.view() == "0.1 1.5 1e+300 -0");
+    builder.clear();
+    builder.append(3.14159, std::chars_format::fixed, 2).append(' ');
+    builder.append(12345.678, std::chars_format::scientific, 3);
+    assert(builder.view() == "3.14 1.235e+04");
+
+    // Output reads back to the same value.
+    const double value = 0.30000000000000004;
+    builder.clear();
+    builder << value;
+    double parsed = 0;
+    std::from_chars(builder.data(), builder.data() + builder.size(), parsed);
+    assert(parsed == value);
+
+    // Pointers to characters are text, never bool.
+    const char* text = "text";
+    builder.clear();
+    builder << text << false;
+    assert(builder.view() == "textfalse");
+
+    std::cout << "Passed.\n";
+}
+
+void test_spill_and_take() {
+    std::cout << "[Test] Spilling / take()... ";
+    AllocationCounter::allocations = 0;
+
+    counted_builder builder;
+    builder << "short message";
+    assert(builder.is_inline() && AllocationCounter::allocations == 0);
+
+    // Short contents are copied into the string's own inline storage.
+    auto small = builder.take();
+    assert(small.size() == 13 && nstd::string_view(small.data(), small.size()) == "short message");
+    assert(AllocationCounter::allocations == 0 && builder.empty());
+
+    // Past the inline capacity, the characters move to the heap once.
+    for (int i = 0; i < 10; ++i) {
+        builder << "field" << i << '=' << i * 1000 << ';';
+    }
+    assert(!builder.is_inline() && builder.size() > 64);
+    const auto spilled = AllocationCounter::allocations;
+    assert(spilled == 1);
+
+    // take() hands the heap buffer over without copying it.
+    const auto* buffer = builder.data();
+    const auto size = builder.size();
+    auto message = builder.take();
+    assert(message.data() == buffer && message.size() == size);
+    assert(message.c_str()[size] == '\0');
+    assert(AllocationCounter::allocations == spilled);
+    assert(nstd::string_view(message.data(), 16) == "field0=0;field1=");
+
+    // The builder is back on its inline buffer and reusable.
+    assert(builder.empty() && builder.is_inline() && builder.capacity() == 64);
+    builder << "again";
+    assert(builder.view() == "again");
+
+    // Growth is geometric.
+    AllocationCounter::allocations = 0;
+    counted_builder large;
+    for (int i = 0; i < 100000; ++i) {
+        large << 'x';
+    }
+    assert(large.size() == 100000 && AllocationCounter::allocations <= 12);
+
+    // Formatting that does not fit the remaining space retries in a larger buffer.
+    counted_builder numbers;
+    numbers.append(size_t{60}, ' ');
+    numbers.append(1e300, std::chars_format::fixed, 2);
+    assert(numbers.size() == 60 + 301 + 3 && numbers.view().substr(60, 2) == "10");
+
+    std::cout << "Passed.\n";
+}
+
+void benchmark_message() {
+    std::cout << "[Benchmark] Message Building vs operator+=...\n";
+    constexpr int messages = 200000;
+
+    // A log line of about 110 characters: too long for the string's inline storage.
+    AllocationCounter::allocations = 0;
+    size_t concat_total = 0;
+    auto concat_ms = time_ms([&concat_total] {
+        for (int i = 0; i < messages; ++i) {
+            nstd::basic_string<char, counting_allocator<char>> line;
+            line += "2024-05-01T12:00:00Z level=INFO host=web-";
+            line += std::to_string(i % 64).c_str();
+            line += " request_id=";
+            line += std::to_string(i).c_str();
+            line += " latency_ms=";
+            line += std::to_string(i % 1000).c_str();
+            line += " path=/api/v1/items/";
+            line += std::to_string(i * 7).c_str();
+            concat_total += line.size();
+        }
+    });
+    const auto concat_allocations = AllocationCounter::allocations;
+
+    AllocationCounter::allocations = 0;
+    size_t builder_total = 0;
+    auto builder_ms = time_ms([&builder_total] {
+        nstd::basic_string_builder<512, counting_allocator<char>> builder;
+        for (int i = 0; i < messages; ++i) {
+            builder << "2024-05-01T12:00:00Z level=INFO host=web-" << i % 64 << " request_id=" << i
+                    << " latency_ms=" << i % 1000 << " path=/api/v1/items/" << i * 7;
+            auto line = builder.take();
+            builder_total += line.size();
+        }
+    });
+    const auto builder_allocations = AllocationCounter::allocations;
+    assert(builder_allocations == messages && builder_total == concat_total);
+
+    std::cout << "    nstd::string +=:      " << concat_ms << "ms, "
+              << concat_allocations / messages << " allocations per message\n";
+    std::cout << "    nstd::string_builder: " << builder_ms << "ms, "
+              << builder_allocations / messages << " allocation per message\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running String Builder Tests ===\n";
+
+    test_append();
+    test_spill_and_take();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace string_builder
+} // namespace tests
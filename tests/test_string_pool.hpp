@@ -0,0 +1,159 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "nstd/string.hpp"
+#include "nstd/string_pool.hpp"
+
+namespace tests {
+namespace string_pool {
+
+void test_interning() {
+    std::cout << "[Test] Deduplication / Handles... ";
+    nstd::string_pool pool;
+
+    const nstd::string owned{"region=eu-west-1"};
+    auto a = pool.intern("region=eu-west-1");
+    auto b = pool.intern(owned);
+    auto c = pool.intern("region=us-east-1");
+
+    // One copy per distinct string; equal strings share a handle.
+    assert(a == b && !(a == c));
+    assert(a.c_str() == b.c_str());
+    assert(a.view() == "region=eu-west-1" && a.size() == 16 && a.c_str()[16] == '\0');
+    assert(pool.size() == 2);
+    assert(sizeof(nstd::interned_string) == sizeof(void*));
+
+    // The pooled characters are a private copy.
+    assert(a.c_str() != owned.c_str());
+
+    // The empty string is the default handle and is never stored.
+    nstd::interned_string empty;
+    assert(pool.intern("") == empty && empty.empty() && empty.id() == 0);
+    assert(empty.c_str()[0] == '\0' && pool.size() == 2);
+
+    assert(pool.find("region=us-east-1") == c);
+    assert(pool.find("region=ap-south-1").empty());
+    assert(pool.contains("region=eu-west-1") && !pool.contains("zone=a"));
+    assert(pool.size() == 2);
+
+    // Handles from another pool are different objects.
+    nstd::string_pool other;
+    assert(!(other.intern("region=eu-west-1") == a));
+
+    std::cout << "Passed.\n";
+}
+
+void test_ids() {
+    std::cout << "[Test] 32-bit Ids / lookup... ";
+    nstd::string_pool pool;
+
+    // Enough strings to need several directory segments per shard.
+    std::vector<nstd::interned_string> handles;
+    for (int i = 0; i < 50000; ++i) {
+        handles.push_back(pool.intern(nstd::string_view{("tag-" + std::to_string(i)).c_str()}));
+    }
+    assert(pool.size() == 50000);
+
+    std::unordered_map<std::uint32_t, int> ids;
+    for (int i = 0; i < 50000; ++i) {
+        const auto id = handles[i].id();
+        assert(id != 0 && ids.emplace(id, i).second);
+        assert(pool.lookup(id) == handles[i]);
+        assert(pool.lookup(id).view() == nstd::string_view{("tag-" + std::to_string(i)).c_str()});
+    }
+    assert(pool.lookup(0).empty());
+
+    // Re-interning returns the existing handle.
+    assert(pool.intern("tag-123") == handles[123] && pool.size() == 50000);
+
+    // Handles work as hash keys.
+    std::unordered_map<nstd::interned_string, int> counts;
+    counts[handles[7]] += 1;
+    counts[pool.intern("tag-7")] += 1;
+    assert(counts.size() == 1 && counts[handles[7]] == 2);
+
+    std::cout << "Passed.\n";
+}
+
+void test_concurrent_interning() {
+    std::cout << "[Test] Concurrent Interning... ";
+    nstd::string_pool pool;
+    constexpr int threads = 8;
+    constexpr int distinct = 5000;
+
+    // Every thread interns the same strings, in a different order.
+    std::vector<std::vector<nstd::interned_string>> results(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            auto& mine = results[t];
+            mine.resize(distinct);
+            for (int n = 0; n < distinct; ++n) {
+                const int i = (n * 7919 + t * 1237) % distinct;
+                mine[i] = pool.intern(nstd::string_view{("metric." + std::to_string(i)).c_str()});
+                assert(pool.lookup(mine[i].id()) == mine[i]);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    assert(pool.size() == distinct);
+    for (int t = 1; t < threads; ++t) {
+        for (int i = 0; i < distinct; ++i) {
+            assert(results[t][i] == results[0][i]);
+        }
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_memory_savings() {
+    std::cout << "[Test] Memory for Repeated Tags...\n";
+    constexpr int count = 1000000;
+    constexpr int distinct = 1000;
+
+    nstd::string_pool pool;
+    std::vector<nstd::interned_string> tags;
+    tags.reserve(count);
+    size_t string_bytes = 0;
+    for (int i = 0; i < count; ++i) {
+        const auto tag = "service=checkout,host=web-" + std::to_string(i % distinct);
+        tags.push_back(pool.intern(nstd::string_view{tag.c_str()}));
+
+        // What an nstd::string per tag would take: the object plus its heap buffer.
+        string_bytes += sizeof(nstd::string) + (tag.size() > nstd::string::inline_capacity
+                                                    ? tag.size() + 1
+                                                    : 0);
+    }
+    assert(pool.size() == distinct);
+
+    size_t pooled_bytes = tags.size() * sizeof(nstd::interned_string);
+    for (int i = 0; i < distinct; ++i) {
+        pooled_bytes += tags[i].size() + 1 + 16 + 8 + 16;
+    }
+
+    std::cout << "    nstd::string per tag: " << string_bytes / 1024 << " KiB\n";
+    std::cout << "    interned handles:     " << pooled_bytes / 1024 << " KiB\n";
+    assert(pooled_bytes * 5 < string_bytes);
+    std::cout << "Passed.\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running String Pool Tests ===\n";
+
+    test_interning();
+    test_ids();
+    test_concurrent_interning();
+    test_memory_savings();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace string_pool
+} // namespace tests
@@ -0,0 +1,277 @@
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+
+namespace tests {
+namespace string_view {
+
+// Most of the view is usable in constant expressions.
+static_assert(nstd::string_view("key=value").find('=') == 3);
+static_assert(nstd::string_view("key=value").substr(4) == "value");
+static_assert(nstd::string_view("GET /index").starts_with("GET "));
+static_assert(nstd::string_view("abc").compare("abd") < 0);
+static_assert(nstd::string_view("a/b/c").rfind('/') == 3);
+static_assert(nstd::string_view("value  \t").find_last_not_of(" \t") == 4);
+
+void test_basics() {
+    std::cout << "[Test] Construction / Access / Slicing... ";
+    nstd::string_view empty;
+    assert(empty.empty() && empty.size() == 0 && empty.begin() == empty.end());
+
+    const char buffer[] = "header: value\r\n";
+    nstd::string_view line{buffer, sizeof(buffer) - 3};
+    assert(line.size() == 13 && line.front() == 'h' && line.back() == 'e');
+    assert(line.data() == buffer);
+
+    auto name = line.substr(0, line.find(':'));
+    auto value = line.substr(line.find(':') + 2);
+    assert(name == "header" && value == "value");
+    assert(value.data() == buffer + 8);
+
+    // count is clamped; a position past the end throws.
+    assert(line.substr(8, 100) == "value");
+    assert(line.substr(13).empty());
+    bool threw = false;
+    try {
+        line.substr(14);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    nstd::string_view trimmed{"  padded  "};
+    trimmed.remove_prefix(2);
+    trimmed.remove_suffix(2);
+    assert(trimmed == "padded" && trimmed.at(5) == 'd');
+
+    std::ostringstream os;
+    os << line.substr(0, 6);
+    assert(os.str() == "header");
+
+    std::cout << "Passed.\n";
+}
+
+void test_find_compare() {
+    std::cout << "[Test] find / compare / starts_with... ";
+    nstd::string_view text{"the cat sat on the mat"};
+
+    assert(text.find("the") == 0);
+    assert(text.find("the", 1) == 15);
+    assert(text.find("at") == 5 && text.find("at", 6) == 9);
+    assert(text.find("mat") == 19);
+    assert(text.find("mats") == nstd::string_view::npos);
+    assert(text.find("") == 0 && text.find("", 22) == 22);
+    assert(text.find("", 23) == nstd::string_view::npos);
+    assert(text.find('s') == 8 && text.find('z') == nstd::string_view::npos);
+    assert(text.contains("sat") && !text.contains("dog") && text.contains('m'));
+
+    // Candidates whose first character matches but the rest does not.
+    assert(nstd::string_view("aaaaab").find("aab") == 3);
+
+    assert(text.starts_with("the ") && text.starts_with('t') && !text.starts_with("cat"));
+    assert(text.ends_with("mat") && text.ends_with('t') && !text.ends_with("cat"));
+    assert(!nstd::string_view{}.starts_with('a'));
+
+    assert(nstd::string_view("abc").compare("abc") == 0);
+    assert(nstd::string_view("ab").compare("abc") < 0);
+    assert(nstd::string_view("abd").compare("abc") > 0);
+    assert(nstd::string_view("ab") < nstd::string_view("abc"));
+    assert(nstd::string_view("b") > nstd::string_view("abc"));
+    assert(nstd::string_view("abc") != "abd");
+
+    std::cout << "Passed.\n";
+}
+
+void test_string_interop() {
+    std::cout << "[Test] basic_string Interop... ";
+    nstd::string s{"name=nstd;version=2"};
+
+    // Strings convert to views without copying.
+    nstd::string_view view = s;
+    assert(view.data() == s.data() && view.size() == s.size());
+
+    auto lookup = [](nstd::string_view key) { return key.size(); };
+    assert(lookup(s) == 19);
+
+    assert(s.find("version") == 10 && s.find(';') == 9);
+    assert(s.find("release") == nstd::string::npos);
+    assert(s.compare("name") > 0 && s.compare(s) == 0);
+    assert(nstd::string_view(s) == "name=nstd;version=2");
+
+    // Appending slices of a view.
+    nstd::string out;
+    out.append(view.substr(0, 4));
+    out += nstd::string_view{": "};
+    out += view.substr(5, 4);
+    assert(out == nstd::string("name: nstd"));
+
+    // Appending a view into the string itself.
+    out.append(nstd::string_view(out).substr(0, 4));
+    assert(out == nstd::string("name: nstdname"));
+
+    // Materialising a view as an owning string.
+    nstd::string copy{view.substr(10)};
+    assert(copy.size() == 9 && copy == nstd::string("version=2"));
+
+    std::cout << "Passed.\n";
+}
+
+void test_split_without_allocation() {
+    std::cout << "[Test] Parsing with Views... ";
+    const nstd::string request{"GET /search?q=nstd&lang=en HTTP/1.1"};
+
+    nstd::string_view rest = request;
+    auto method = rest.substr(0, rest.find(' '));
+    rest.remove_prefix(method.size() + 1);
+    auto target = rest.substr(0, rest.find(' '));
+    auto query = target.substr(target.find('?') + 1);
+
+    std::vector<nstd::string_view> params;
+    while (!query.empty()) {
+        const auto amp = query.find('&');
+        params.push_back(query.substr(0, amp));
+        query.remove_prefix(amp == nstd::string_view::npos ? query.size() : amp + 1);
+    }
+
+    assert(method == "GET" && target == "/search?q=nstd&lang=en");
+    assert(params.size() == 2 && params[0] == "q=nstd" && params[1] == "lang=en");
+
+    // Every piece points into the original buffer.
+    for (auto param : params) {
+        assert(param.data() >= request.data() && param.data() < request.data() + request.size());
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_search_against_std() {
+    std::cout << "[Test] Searches vs std::string_view... ";
+    std::mt19937 rng(42);
+
+    // Short alphabets make matches and near-matches frequent; the lengths cross several vector
+    // block boundaries.
+    auto random_text = [&](size_t length, int alphabet) {
+        std::string text(length, 'a');
+        for (auto& ch : text) {
+            ch = static_cast<char>('a' + rng() % alphabet);
+        }
+        return text;
+    };
+
+    for (int round = 0; round < 3000; ++round) {
+        const auto text = random_text(rng() % 130, 1 + round % 4);
+        const auto needle = random_text(rng() % 6, 1 + round % 4);
+        const auto set = random_text(1 + rng() % 11, 3 + round % 4);
+        const size_t pos = rng() % (text.size() + 3);
+
+        const std::string_view expected{text};
+        const nstd::string_view view{text.data(), text.size()};
+        const nstd::string_view pattern{needle.data(), needle.size()};
+        const nstd::string_view members{set.data(), set.size()};
+
+        assert(view.find(pattern, pos) == expected.find(needle, pos));
+        assert(view.rfind(pattern, pos) == expected.rfind(needle, pos));
+        assert(view.rfind(pattern) == expected.rfind(needle));
+        assert(view.find(set[0], pos) == expected.find(set[0], pos));
+        assert(view.rfind(set[0], pos) == expected.rfind(set[0], pos));
+        assert(view.find_first_of(members, pos) == expected.find_first_of(set, pos));
+        assert(view.find_last_of(members, pos) == expected.find_last_of(set, pos));
+        assert(view.find_first_not_of(members, pos) == expected.find_first_not_of(set, pos));
+        assert(view.find_last_not_of(members, pos) == expected.find_last_not_of(set, pos));
+        assert(view.find_last_not_of(set[0], pos) == expected.find_last_not_of(set[0], pos));
+        assert((view.compare(pattern) < 0) == (expected.compare(needle) < 0));
+        assert((view.compare(pattern) == 0) == (expected.compare(needle) == 0));
+    }
+
+    // Bytes above 0x7F are ordinary characters to the kernels.
+    const std::string binary{"\x01\xff\x80payload\xfe\x80\xff"};
+    nstd::string_view bytes{binary.data(), binary.size()};
+    assert(bytes.find("\xfe\x80") == 10 && bytes.rfind('\xff') == 12);
+    assert(bytes.find_first_not_of("\x01\xff\x80") == 3);
+
+    // Other character types take the portable path.
+    nstd::basic_string_view<char16_t> wide{u"one,two;three"};
+    assert(wide.find(u"two") == 4 && wide.rfind(u'e') == 12);
+    assert(wide.find_first_of(u",;") == 3 && wide.find_last_of(u",;") == 7);
+
+    // The same searches through nstd::string.
+    nstd::string line{"2024-05-01 12:00:00 [ERROR] disk full   "};
+    assert(line.find("[ERROR]") == 20 && line.rfind(':') == 16);
+    assert(line.find_first_of("[]") == 20 && line.find_last_of("[]") == 26);
+    assert(line.find_first_not_of("0123456789-") == 10);
+    assert(line.find_last_not_of(" ") == 36);
+    assert(line.compare("2024") > 0 && line < nstd::string("2025"));
+
+    std::cout << "Passed.\n";
+}
+
+void benchmark_log_scan() {
+    std::cout << "[Benchmark] Log Scan vs Scalar Search...\n";
+    std::mt19937 rng(3);
+    std::string log;
+    size_t expected = 0;
+    for (int i = 0; i < 200000; ++i) {
+        const bool error = rng() % 50 == 0;
+        expected += error;
+        log += "2024-05-01T12:00:00Z host-";
+        log += std::to_string(rng() % 1000);
+        log += error ? " level=ERROR " : " level=INFO ";
+        log += "request handled in 12ms path=/api/v1/items\n";
+    }
+    const nstd::string_view text{log.data(), log.size()};
+
+    auto count_with = [&](auto find) {
+        size_t count = 0;
+        const auto ms = time_ms([&] {
+            for (int round = 0; round < 5; ++round) {
+                for (size_t pos = find(0); pos != nstd::string_view::npos; pos = find(pos + 1)) {
+                    ++count;
+                }
+            }
+        });
+        assert(count == 5 * expected);
+        return std::pair{ms, count};
+    };
+
+    // Scalar baseline: first-character jumps plus a comparison, the pre-SIMD algorithm.
+    auto scalar = [&](size_t from) -> size_t {
+        const nstd::string_view needle{"ERROR"};
+        for (size_t i = from; i + needle.size() <= text.size(); ++i) {
+            if (text[i] == 'E' && text.substr(i, needle.size()) == needle) {
+                return i;
+            }
+        }
+        return nstd::string_view::npos;
+    };
+
+    const auto [scalar_ms, scalar_count] = count_with(scalar);
+    const auto [simd_ms, simd_count] =
+        count_with([&](size_t from) { return text.find("ERROR", from); });
+    std::cout << "    scalar:            " << scalar_ms << "ms (" << scalar_count << " matches)\n";
+    std::cout << "    nstd::string_view: " << simd_ms << "ms (" << simd_count << " matches, "
+              << log.size() / (1024 * 1024) << " MiB)\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running String View Tests ===\n";
+
+    test_basics();
+    test_find_compare();
+    test_string_interop();
+    test_split_without_allocation();
+    test_search_against_std();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace string_view
+} // namespace tests
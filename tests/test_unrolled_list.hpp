@@ -0,0 +1,265 @@
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "nstd/list.hpp"
+#include "nstd/unrolled_list.hpp"
+
+namespace tests {
+namespace unrolled_list {
+
+template<typename List, typename T> bool matches(const List& l, const std::vector<T>& expected) {
+    if (l.size() != expected.size()) {
+        return false;
+    }
+    auto it = l.begin();
+    for (const auto& x : expected) {
+        if (!(*it == x)) {
+            return false;
+        }
+        ++it;
+    }
+    return it == l.end();
+}
+
+void test_push_pop() {
+    std::cout << "[Test] Push / Pop at Both Ends... ";
+    nstd::unrolled_list<int, 4> l;
+    assert(l.empty() && l.begin() == l.end());
+
+    for (int i = 0; i < 10; ++i) {
+        l.push_back(i);
+    }
+    for (int i = -1; i >= -3; --i) {
+        l.push_front(i);
+    }
+    assert(l.size() == 13);
+    assert(l.front() == -3 && l.back() == 9);
+
+    std::vector<int> expected{-3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    assert(matches(l, expected));
+
+    l.pop_front();
+    l.pop_back();
+    assert(l.front() == -2 && l.back() == 8 && l.size() == 11);
+
+    while (!l.empty()) {
+        l.pop_back();
+    }
+    assert(l.node_count() == 0 && l.begin() == l.end());
+
+    std::cout << "Passed.\n";
+}
+
+void test_node_packing() {
+    std::cout << "[Test] Elements Are Packed Into Nodes... ";
+    nstd::unrolled_list<int, 16> l;
+
+    for (int i = 0; i < 1600; ++i) {
+        l.push_back(i);
+    }
+
+    // Appending fills every node completely.
+    assert(l.node_count() == 100);
+
+    // Consecutive elements of a node are contiguous.
+    auto it = l.begin();
+    const int* first = &*it;
+    ++it;
+    assert(&*it == first + 1);
+
+    std::cout << "Passed.\n";
+}
+
+void test_split_on_insert() {
+    std::cout << "[Test] Insert Splits Full Nodes... ";
+    nstd::unrolled_list<int, 4> l;
+    for (int i = 0; i < 8; ++i) {
+        l.push_back(i * 10);
+    }
+    assert(l.node_count() == 2);
+
+    // Middle of a full node.
+    auto pos = std::next(l.begin(), 2);
+    auto it = l.insert(pos, 15);
+    assert(*it == 15);
+    assert(l.node_count() == 3);
+    assert(matches(l, std::vector<int>{0, 10, 15, 20, 30, 40, 50, 60, 70}));
+
+    // At the end of a node that has room, and before end().
+    it = l.insert(std::next(l.begin(), 3), 17);
+    assert(*it == 17 && *std::next(it) == 20);
+    it = l.insert(l.end(), 80);
+    assert(*it == 80 && l.back() == 80);
+
+    // Iteration in both directions.
+    std::vector<int> backwards;
+    for (auto rit = l.end(); rit != l.begin();) {
+        --rit;
+        backwards.push_back(*rit);
+    }
+    assert((backwards == std::vector<int>{80, 70, 60, 50, 40, 30, 20, 17, 15, 10, 0}));
+
+    std::cout << "Passed.\n";
+}
+
+void test_merge_on_erase() {
+    std::cout << "[Test] Erase Merges Sparse Nodes... ";
+    nstd::unrolled_list<int, 8> l;
+    for (int i = 0; i < 64; ++i) {
+        l.push_back(i);
+    }
+    assert(l.node_count() == 8);
+
+    // Keep every fourth element; nodes fold together as they empty out.
+    for (auto it = l.begin(); it != l.end();) {
+        for (int i = 0; i < 3 && it != l.end(); ++i) {
+            it = l.erase(it);
+        }
+        if (it != l.end()) {
+            ++it;
+        }
+    }
+    assert(l.size() == 16);
+    assert(l.node_count() <= 4);
+
+    int expected = 3;
+    for (int x : l) {
+        assert(x == expected);
+        expected += 4;
+    }
+
+    // Range erase over node boundaries.
+    auto after = l.erase(std::next(l.begin(), 2), std::next(l.begin(), 14));
+    assert(*after == 59);
+    assert(matches(l, std::vector<int>{3, 7, 59, 63}));
+    auto rest = l.erase(l.begin(), l.end());
+    assert(rest == l.end());
+    assert(l.empty() && l.node_count() == 0);
+
+    std::cout << "Passed.\n";
+}
+
+void test_non_trivial_elements() {
+    std::cout << "[Test] Non-Trivial Elements... ";
+    nstd::unrolled_list<std::string, 4> l;
+
+    for (int i = 0; i < 20; ++i) {
+        l.push_back(std::string(30, static_cast<char>('a' + i)));
+    }
+    l.insert(std::next(l.begin(), 5), std::string(40, 'X'));
+    l.emplace_front(25, 'F');
+    auto& back = l.emplace_back(3, 'B');
+    assert(back == "BBB" && &back == &l.back());
+
+    l.erase(std::next(l.begin(), 3));
+    assert(l.front() == std::string(25, 'F'));
+    assert(*std::next(l.begin(), 5) == std::string(40, 'X'));
+
+    // Copy and move keep the elements intact.
+    auto copy = l;
+    assert(copy.size() == l.size());
+    assert(std::equal(copy.begin(), copy.end(), l.begin()));
+
+    auto moved = std::move(copy);
+    assert(copy.empty() && moved.size() == l.size());
+
+    nstd::unrolled_list<std::string, 4> assigned;
+    assigned.push_back("old");
+    assigned = moved;
+    assert(std::equal(assigned.begin(), assigned.end(), l.begin()));
+
+    swap(assigned, copy);
+    assert(assigned.empty() && copy.size() == l.size());
+
+    std::cout << "Passed.\n";
+}
+
+void test_random_operations() {
+    std::cout << "[Test] Random Operations vs std::vector... ";
+    std::mt19937 rng(7);
+    nstd::unrolled_list<int, 6> l;
+    std::vector<int> reference;
+
+    for (int step = 0; step < 20000; ++step) {
+        const auto op = rng() % 4;
+        if (op < 2 || reference.empty()) {
+            const size_t index = rng() % (reference.size() + 1);
+            const int value = static_cast<int>(rng());
+            auto it = l.insert(std::next(l.begin(), static_cast<long>(index)), value);
+            assert(*it == value);
+            reference.insert(reference.begin() + static_cast<long>(index), value);
+        } else {
+            const size_t index = rng() % reference.size();
+            auto it = l.erase(std::next(l.begin(), static_cast<long>(index)));
+            reference.erase(reference.begin() + static_cast<long>(index));
+            if (index < reference.size()) {
+                assert(*it == reference[index]);
+            } else {
+                assert(it == l.end());
+            }
+        }
+
+        if (step % 1000 == 0) {
+            assert(matches(l, reference));
+        }
+    }
+    assert(matches(l, reference));
+
+    // Nodes stay reasonably full under mixed traffic.
+    assert(l.node_count() <= l.size() / 2 + 2);
+
+    std::cout << "Passed.\n";
+}
+
+void benchmark_iteration() {
+    std::cout << "[Benchmark] Iteration vs nstd::list...\n";
+    constexpr int count = 1000000;
+
+    nstd::list<int> plain;
+    nstd::unrolled_list<int> unrolled;
+    for (int i = 0; i < count; ++i) {
+        plain.push_back(i);
+        unrolled.push_back(i);
+    }
+
+    auto time_sum = [](const auto& container) {
+        long long sum = 0;
+        const auto ms = time_ms([&] {
+            for (int round = 0; round < 10; ++round) {
+                for (int x : container) {
+                    sum += x;
+                }
+            }
+        });
+        assert(sum == 10LL * (count - 1LL) * count / 2);
+        return std::pair{ms, sum};
+    };
+
+    // The sums are printed so the loops stay observable when NDEBUG compiles the asserts out.
+    const auto [plain_ms, plain_sum] = time_sum(plain);
+    const auto [unrolled_ms, unrolled_sum] = time_sum(unrolled);
+    std::cout << "    nstd::list:          " << plain_ms << "ms (sum " << plain_sum << ")\n";
+    std::cout << "    nstd::unrolled_list: " << unrolled_ms << "ms (sum " << unrolled_sum << ", "
+              << unrolled.node_count() << " nodes)\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running Unrolled List Tests ===\n";
+
+    test_push_pop();
+    test_node_packing();
+    test_split_on_insert();
+    test_merge_on_erase();
+    test_non_trivial_elements();
+    test_random_operations();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace unrolled_list
+} // namespace tests
@@ -0,0 +1,252 @@
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "nstd/string.hpp"
+#include "nstd/string_view.hpp"
+#include "nstd/utf8.hpp"
+
+namespace tests {
+namespace utf8 {
+
+nstd::string_view as_view(const std::string& str) {
+    return {str.data(), str.size()};
+}
+
+// Straightforward reference encoder for generating test input.
+void append_code_point(std::string& out, char32_t code_point) {
+    char buffer[4];
+    auto* end = nstd::detail::encode_utf8(code_point, buffer);
+    out.append(buffer, end);
+}
+
+char32_t random_code_point(std::mt19937& rng) {
+    switch (rng() % 4) {
+    case 0:
+        return rng() % 0x80;
+    case 1:
+        return 0x80 + rng() % (0x800 - 0x80);
+    case 2: {
+        char32_t code_point = 0x800 + rng() % (0x10000 - 0x800);
+        return code_point >= 0xD800 && code_point < 0xE000 ? code_point - 0x800 : code_point;
+    }
+    default:
+        return 0x10000 + rng() % (0x110000 - 0x10000);
+    }
+}
+
+void test_validation() {
+    std::cout << "[Test] Validation / Error Positions... ";
+    struct sample {
+        std::string bytes;
+        size_t error;
+    };
+    constexpr auto valid = nstd::string_view::npos;
+
+    const std::vector<sample> samples{
+        {"", valid},
+        {"plain ascii", valid},
+        {"caf\xC3\xA9", valid},
+        {"\xE2\x82\xAC 100", valid},
+        {"\xF0\x9F\x98\x80!", valid},
+        {"\xF4\x8F\xBF\xBF", valid},          // U+10FFFF
+        {"\xED\x9F\xBF", valid},              // U+D7FF, just below the surrogates
+        {"\xEF\xBF\xBF", valid},              // U+FFFF
+        {"ab\x80", 2},                        // stray continuation
+        {"\xC3", 0},                          // truncated at the end
+        {"\xC3x", 0},                         // lead without continuation
+        {"\xC0\xAF", 0},                      // overlong '/'
+        {"\xC1\xBF", 0},                      // overlong
+        {"\xE0\x9F\xBF", 0},                  // overlong three-byte form
+        {"\xED\xA0\x80", 0},                  // surrogate U+D800
+        {"ok\xF0\x8F\xBF\xBF", 2},            // overlong four-byte form
+        {"\xF4\x90\x80\x80", 0},              // above U+10FFFF
+        {"\xF5\x80\x80\x80", 0},              // invalid lead
+        {"\xFF", 0},
+        {"\xE2\x82", 0},                      // truncated three-byte
+        {"\xC3\xA9\xA9", 2},                  // one continuation too many
+        {"\xF0\x9F\x98", 0},                  // truncated four-byte
+    };
+
+    for (const auto& [bytes, error] : samples) {
+        const auto text = as_view(bytes);
+        assert(nstd::is_valid_utf8(text) == (error == valid));
+        const auto result = nstd::validate_utf8(text);
+        assert(result.has_value() == (error == valid));
+        if (!result) {
+            assert(result.error().position == error);
+        }
+
+        // The same bytes at every offset of a longer ASCII buffer, across vector blocks.
+        for (size_t offset = 0; offset < 70; offset += 7) {
+            std::string padded(offset, 'a');
+            padded += bytes;
+            padded.append(offset % 3 == 0 ? 0 : 40, 'z');
+            const auto outcome = nstd::validate_utf8(as_view(padded));
+            assert(outcome.has_value() == (error == valid));
+            assert(outcome || outcome.error().position == offset + error);
+        }
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_random_against_scalar() {
+    std::cout << "[Test] Random Input vs Scalar Validator... ";
+    std::mt19937 rng(47);
+
+    for (int round = 0; round < 5000; ++round) {
+        std::string text;
+        const auto code_points = rng() % 80;
+        for (size_t i = 0; i < code_points; ++i) {
+            append_code_point(text, round % 3 == 0 ? rng() % 0x80 : random_code_point(rng));
+        }
+        // Corrupt some inputs: random bytes, truncations and swapped bytes.
+        if (round % 2 == 1 && !text.empty()) {
+            const auto pos = rng() % text.size();
+            switch (rng() % 3) {
+            case 0:
+                text[pos] = static_cast<char>(rng());
+                break;
+            case 1:
+                text.resize(pos);
+                break;
+            default:
+                std::swap(text[pos], text[rng() % text.size()]);
+                break;
+            }
+        }
+
+        const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+        const auto expected_error = nstd::detail::find_invalid_utf8(bytes, text.size());
+        assert(nstd::is_valid_utf8(as_view(text)) == (expected_error == text.size()));
+#if defined(NSTD_SIMD_UTF8)
+        // Only one kernel is dispatched to, so check every one this CPU can run.
+        if (__builtin_cpu_supports("avx2")) {
+            assert(nstd::detail::utf8_avx2::validate(bytes, text.size()) ==
+                   (expected_error == text.size()));
+        }
+        if (__builtin_cpu_supports("ssse3")) {
+            assert(nstd::detail::utf8_ssse3::validate(bytes, text.size()) ==
+                   (expected_error == text.size()));
+        }
+#endif
+
+        const auto as_utf32 = nstd::utf8_to_utf32(as_view(text));
+        assert(as_utf32.has_value() == (expected_error == text.size()));
+        if (!as_utf32) {
+            assert(as_utf32.error().position == expected_error);
+        }
+    }
+
+    std::cout << "Passed.\n";
+}
+
+void test_transcoding() {
+    std::cout << "[Test] UTF-8 <-> UTF-16 / UTF-32... ";
+    const auto utf16 = nstd::utf8_to_utf16("Gr\xC3\xBC\xC3\x9F \xE2\x82\xAC \xF0\x9F\x98\x80");
+    assert(utf16 && *utf16 == nstd::u16string(u"Grüß € 😀"));
+    const auto utf32 = nstd::utf8_to_utf32("Gr\xC3\xBC\xC3\x9F \xE2\x82\xAC \xF0\x9F\x98\x80");
+    assert(utf32 && *utf32 == nstd::u32string(U"Grüß € 😀"));
+
+    const auto narrowed = nstd::utf16_to_utf8(u"Grüß € 😀");
+    assert(narrowed);
+    assert(nstd::string_view(*narrowed) == "Gr\xC3\xBC\xC3\x9F \xE2\x82\xAC \xF0\x9F\x98\x80");
+    const auto from_utf32 = nstd::utf32_to_utf8(U"Grüß € 😀");
+    assert(from_utf32 && *from_utf32 == *narrowed);
+
+    // Round trips of random text, long enough for the ASCII block paths; outputs are allocated
+    // at their exact final size.
+    std::mt19937 rng(8);
+    for (int round = 0; round < 300; ++round) {
+        std::u32string code_points;
+        std::string text;
+        const auto count = rng() % 200;
+        for (size_t i = 0; i < count; ++i) {
+            const auto code_point = round % 2 ? random_code_point(rng) : rng() % 0x80;
+            code_points.push_back(code_point);
+            append_code_point(text, code_point);
+        }
+
+        const auto wide = nstd::utf8_to_utf32(as_view(text));
+        assert(wide && wide->size() == code_points.size());
+        assert(std::u32string_view(wide->data(), wide->size()) == code_points);
+        assert(wide->size() <= nstd::u32string::inline_capacity ||
+               wide->capacity() == wide->size());
+
+        const auto units = nstd::utf8_to_utf16(as_view(text));
+        assert(units);
+        assert(units->size() <= nstd::u16string::inline_capacity ||
+               units->capacity() == units->size());
+
+        const auto back = nstd::utf16_to_utf8(*units);
+        assert(back && nstd::string_view(*back) == as_view(text));
+        assert(back->size() <= nstd::string::inline_capacity || back->capacity() == back->size());
+        const auto back_32 = nstd::utf32_to_utf8(*wide);
+        assert(back_32 && *back_32 == *back);
+    }
+
+    // Unpaired surrogates and out-of-range code points are reported, not replaced.
+    const char16_t lone_high[] = {u'a', 0xD83D, u'b', 0};
+    assert(nstd::utf16_to_utf8(lone_high).error().position == 1);
+    const char16_t lone_low[] = {u'a', u'b', 0xDE00, 0};
+    assert(nstd::utf16_to_utf8(lone_low).error().position == 2);
+    const char16_t truncated[] = {u'x', 0xD83D, 0};
+    assert(nstd::utf16_to_utf8(truncated).error().position == 1);
+    const char32_t too_large[] = {U'a', 0x110000, 0};
+    assert(nstd::utf32_to_utf8(too_large).error().position == 1);
+    const char32_t surrogate[] = {0xDFFF, 0};
+    assert(nstd::utf32_to_utf8(surrogate).error().position == 0);
+    assert(nstd::utf8_to_utf16("ok\xFF").error() == nstd::utf_error{2});
+
+    std::cout << "Passed.\n";
+}
+
+void benchmark_validation() {
+    std::cout << "[Benchmark] Validation Throughput vs Scalar...\n";
+    std::mt19937 rng(5);
+    std::string text;
+    while (text.size() < 16 * 1024 * 1024) {
+        // Mostly ASCII with a sprinkling of multi-byte characters, as in typical ingress text.
+        append_code_point(text, rng() % 8 == 0 ? random_code_point(rng) : 0x20 + rng() % 0x5F);
+    }
+    const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+    constexpr int rounds = 5;
+
+    // Returns GB/s and how many rounds found the text valid, which is printed so the calls stay
+    // observable when NDEBUG compiles the asserts out.
+    auto throughput = [&](auto validate) {
+        int valid = 0;
+        const auto ms = time_ms([&] {
+            for (int round = 0; round < rounds; ++round) {
+                valid += validate();
+            }
+        });
+        assert(valid == rounds);
+        return std::pair{static_cast<double>(text.size()) * rounds / ms / 1e6, valid};
+    };
+
+    const auto [scalar, scalar_valid] = throughput(
+        [&] { return nstd::detail::find_invalid_utf8(bytes, text.size()) == text.size(); });
+    const auto [fast, fast_valid] = throughput([&] { return nstd::is_valid_utf8(as_view(text)); });
+    std::cout << "    scalar:              " << scalar << " GB/s (" << scalar_valid << "/" << rounds
+              << " valid)\n";
+    std::cout << "    nstd::is_valid_utf8: " << fast << " GB/s (" << fast_valid << "/" << rounds
+              << " valid)\n";
+}
+
+void run_all_tests() {
+    std::cout << "=== Running UTF-8 Tests ===\n";
+
+    test_validation();
+    test_random_against_scalar();
+    test_transcoding();
+
+    std::cout << "=== All Tests Passed ===\n";
+}
+} // namespace utf8
+} // namespace tests
@@ -1,11 +1,22 @@
 #ifndef TESTS_VECTOR_ENHANCED_HPP
 #define TESTS_VECTOR_ENHANCED_HPP
 
+#include "benchmark.hpp"
+#include "nstd/arena.hpp"
+#include "nstd/shared_ptr.hpp"
+#include "nstd/slab_allocator.hpp"
+#include "nstd/string.hpp"
+#include "nstd/unique_ptr.hpp"
 #include "nstd/vector.hpp"
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <list>
+#include <ranges>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -106,6 +117,45 @@ struct MoveOnly {
     }
 };
 
+// ==========================================
+// HELPER: Stateful allocator with configurable propagation
+// ==========================================
+// Every allocator carries an id; live[id] counts the bytes currently allocated through it, so a
+// buffer returned to the wrong allocator shows up as a mismatch.
+inline long long tracking_live[4]{};
+
+template<typename T, bool POCCA = false, bool POCMA = false, bool POCS = false>
+struct TrackingAlloc {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::bool_constant<POCCA>;
+    using propagate_on_container_move_assignment = std::bool_constant<POCMA>;
+    using propagate_on_container_swap = std::bool_constant<POCS>;
+
+    template<typename U> struct rebind {
+        using other = TrackingAlloc<U, POCCA, POCMA, POCS>;
+    };
+
+    int id;
+
+    explicit TrackingAlloc(int i) : id(i) {}
+    template<typename U>
+    TrackingAlloc(const TrackingAlloc<U, POCCA, POCMA, POCS>& other) : id(other.id) {}
+
+    T* allocate(size_t n) {
+        tracking_live[id] += static_cast<long long>(n * sizeof(T));
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) {
+        tracking_live[id] -= static_cast<long long>(n * sizeof(T));
+        ::operator delete(p);
+    }
+
+    friend bool operator==(const TrackingAlloc& a, const TrackingAlloc& b) {
+        return a.id == b.id;
+    }
+};
+
 // ==========================================
 // BASIC TESTS (Enhanced)
 // ==========================================
@@ -562,71 +612,117 @@ void test_insert_count() {
     std::cout << "PASSED\n";
 }
 
-// void test_insert_range()
-//{
-//    std::cout << "[Test] Insert (Range)... ";
-
-//    // Insert empty range
-//    {
-//        nstd::vector<int> v = { 1, 2, 3 };
-//        std::vector<int> empty;
-//        auto it = v.insert(v.cbegin() + 1, empty.begin(), empty.end());
-//        assert(it == v.begin() + 1);
-//        assert(v.size() == 3);
-//    }
-
-//    // Insert range into empty
-//    {
-//        nstd::vector<int> v;
-//        std::vector<int> src = { 1, 2, 3 };
-//        auto it = v.insert(v.cbegin(), src.begin(), src.end());
-//        assert(*it == 1);
-//        assert(v.size() == 3);
-//        assert(v[0] == 1 && v[2] == 3);
-//    }
-
-//    // Insert range at beginning
-//    {
-//        nstd::vector<int> v = { 4, 5 };
-//        std::vector<int> src = { 1, 2, 3 };
-//        auto it = v.insert(v.cbegin(), src.begin(), src.end());
-//        assert(*it == 1);
-//        assert(v.size() == 5);
-//        assert(v[0] == 1 && v[2] == 3 && v[3] == 4);
-//    }
-
-//    // Insert range at end
-//    {
-//        nstd::vector<int> v = { 1, 2 };
-//        std::vector<int> src = { 3, 4, 5 };
-//        auto it = v.insert(v.cend(), src.begin(), src.end());
-//        assert(*it == 3);
-//        assert(v.size() == 5);
-//        assert(v[4] == 5);
-//    }
-
-//    // Insert range in middle
-//    {
-//        nstd::vector<int> v = { 1, 5 };
-//        std::vector<int> src = { 2, 3, 4 };
-//        auto it = v.insert(v.cbegin() + 1, src.begin(), src.end());
-//        assert(*it == 2);
-//        assert(v.size() == 5);
-//        assert(v[0] == 1 && v[1] == 2 && v[2] == 3 && v[3] == 4 && v[4] == 5);
-//    }
-
-//    // Insert partial range
-//    {
-//        nstd::vector<int> v = { 1, 5 };
-//        std::vector<int> src = { 2, 3, 4, 99, 100 };
-//        auto it = v.insert(v.cbegin() + 1, src.begin(), src.begin() + 3);
-//        assert(*it == 2);
-//        assert(v.size() == 5);
-//        assert(v[3] == 4 && v[4] == 5);
-//    }
-
-//    std::cout << "PASSED\n";
-//}
+void test_insert_range() {
+    std::cout << "[Test] Insert (Range)... ";
+
+    // Insert empty range
+    {
+        nstd::vector<int> v = {1, 2, 3};
+        std::vector<int> empty;
+        auto it = v.insert(v.cbegin() + 1, empty.begin(), empty.end());
+        assert(it == v.begin() + 1);
+        assert(v.size() == 3);
+    }
+
+    // Insert range into empty
+    {
+        nstd::vector<int> v;
+        std::vector<int> src = {1, 2, 3};
+        auto it = v.insert(v.cbegin(), src.begin(), src.end());
+        assert(*it == 1);
+        assert(v.size() == 3);
+        assert(v[0] == 1 && v[2] == 3);
+    }
+
+    // Insert range at beginning
+    {
+        nstd::vector<int> v = {4, 5};
+        std::vector<int> src = {1, 2, 3};
+        auto it = v.insert(v.cbegin(), src.begin(), src.end());
+        assert(*it == 1);
+        assert(v.size() == 5);
+        assert(v[0] == 1 && v[2] == 3 && v[3] == 4);
+    }
+
+    // Insert range at end
+    {
+        nstd::vector<int> v = {1, 2};
+        std::vector<int> src = {3, 4, 5};
+        auto it = v.insert(v.cend(), src.begin(), src.end());
+        assert(*it == 3);
+        assert(v.size() == 5);
+        assert(v[4] == 5);
+    }
+
+    // Insert range in middle
+    {
+        nstd::vector<int> v = {1, 5};
+        std::vector<int> src = {2, 3, 4};
+        auto it = v.insert(v.cbegin() + 1, src.begin(), src.end());
+        assert(*it == 2);
+        assert(v.size() == 5);
+        assert(v[0] == 1 && v[1] == 2 && v[2] == 3 && v[3] == 4 && v[4] == 5);
+    }
+
+    // Insert partial range
+    {
+        nstd::vector<int> v = {1, 5};
+        std::vector<int> src = {2, 3, 4, 99, 100};
+        auto it = v.insert(v.cbegin() + 1, src.begin(), src.begin() + 3);
+        assert(*it == 2);
+        assert(v.size() == 5);
+        assert(v[3] == 4 && v[4] == 5);
+    }
+
+    // Initializer list
+    {
+        nstd::vector<int> v = {1, 5};
+        v.insert(v.cbegin() + 1, {2, 3, 4});
+        assert(v == (nstd::vector<int>{1, 2, 3, 4, 5}));
+    }
+
+    // Non-trivial elements, within capacity: a tail longer and shorter than the range, and with
+    // a reallocation.
+    Obj::reset_stats();
+    {
+        std::vector<Obj> src = {Obj(10), Obj(11), Obj(12)};
+
+        nstd::vector<Obj> long_tail = {Obj(0), Obj(1), Obj(2), Obj(3), Obj(4), Obj(5)};
+        long_tail.reserve(20);
+        long_tail.insert(long_tail.cbegin() + 1, src.begin(), src.end());
+        const int long_expected[] = {0, 10, 11, 12, 1, 2, 3, 4, 5};
+        assert(long_tail.size() == 9);
+        for (size_t i = 0; i < long_tail.size(); ++i) {
+            assert(long_tail[i].value == long_expected[i]);
+        }
+
+        nstd::vector<Obj> short_tail = {Obj(0), Obj(1), Obj(2)};
+        short_tail.reserve(20);
+        short_tail.insert(short_tail.cbegin() + 2, src.begin(), src.end());
+        const int short_expected[] = {0, 1, 10, 11, 12, 2};
+        assert(short_tail.size() == 6);
+        for (size_t i = 0; i < short_tail.size(); ++i) {
+            assert(short_tail[i].value == short_expected[i]);
+        }
+
+        nstd::vector<Obj> full = {Obj(0), Obj(1)};
+        full.shrink_to_fit();
+        full.insert(full.cbegin() + 1, src.begin(), src.end());
+        assert(full.size() == 5 && full[1].value == 10 && full[4].value == 1);
+    }
+    Obj::verify_no_leaks();
+
+    // Heap strings move by memmove within the buffer.
+    {
+        nstd::vector<nstd::string> v = {nstd::string("first, a string too long to be inline"),
+                                        nstd::string("last, also too long to be stored inline")};
+        std::vector<nstd::string> src(3, nstd::string("an inserted string that needs the heap"));
+        v.insert(v.cbegin() + 1, src.begin(), src.end());
+        assert(v.size() == 5 && v[0][0] == 'f' && v[1][0] == 'a' && v[4][0] == 'l');
+    }
+
+    std::cout << "PASSED\n";
+}
 
 void test_insert_aliasing() {
     std::cout << "[Test] Insert (Aliasing Safety)... ";
@@ -1615,6 +1711,560 @@ void test_assign_edge_cases() {
     std::cout << "PASSED\n";
 }
 
+// ==========================================
+// ALLOCATOR TESTS
+// ==========================================
+
+void test_allocator_stateful() {
+    std::cout << "[Test] Stateful Allocator... ";
+
+    {
+        using Alloc = TrackingAlloc<int>;
+        nstd::vector<int, Alloc> v{Alloc{1}};
+        for (int i = 0; i < 100; ++i) {
+            v.push_back(i);
+        }
+        assert(tracking_live[1] == static_cast<long long>(v.get_capacity() * sizeof(int)));
+        assert(v.get_allocator().id == 1);
+
+        // Copy construction keeps the allocator (select_on_container_copy_construction default).
+        nstd::vector<int, Alloc> copy{v};
+        assert(copy.get_allocator().id == 1);
+
+        // Allocator-extended copy uses the one we pass.
+        nstd::vector<int, Alloc> other{v, Alloc{2}};
+        assert(other.get_allocator().id == 2);
+        assert(other == v);
+        assert(tracking_live[2] > 0);
+
+        v.shrink_to_fit();
+        v.clear();
+        v.shrink_to_fit();
+    }
+
+    assert(tracking_live[1] == 0 && tracking_live[2] == 0);
+    std::cout << "PASSED\n";
+}
+
+void test_allocator_copy_assignment_propagation() {
+    std::cout << "[Test] Allocator Copy Assignment Propagation... ";
+
+    {
+        using Alloc = TrackingAlloc<int, true>;
+        nstd::vector<int, Alloc> a({1, 2, 3}, Alloc{1});
+        nstd::vector<int, Alloc> b({4, 5}, Alloc{2});
+
+        b = a;
+        assert(b.get_allocator().id == 1);
+        assert(b == a);
+    }
+    assert(tracking_live[1] == 0 && tracking_live[2] == 0);
+
+    {
+        using Alloc = TrackingAlloc<int, false>;
+        nstd::vector<int, Alloc> a({1, 2, 3}, Alloc{1});
+        nstd::vector<int, Alloc> b({4, 5}, Alloc{2});
+
+        b = a;
+        assert(b.get_allocator().id == 2);
+        assert(b == a);
+    }
+    assert(tracking_live[1] == 0 && tracking_live[2] == 0);
+
+    std::cout << "PASSED\n";
+}
+
+void test_allocator_move_assignment_propagation() {
+    std::cout << "[Test] Allocator Move Assignment Propagation... ";
+
+    {
+        using Alloc = TrackingAlloc<Obj, false, true>;
+        nstd::vector<Obj, Alloc> a({1, 2, 3}, Alloc{1});
+        nstd::vector<Obj, Alloc> b({4, 5}, Alloc{2});
+        auto* buffer = a.data();
+
+        // Propagating: the buffer is stolen together with the allocator.
+        b = std::move(a);
+        assert(b.get_allocator().id == 1);
+        assert(b.data() == buffer);
+        assert(tracking_live[2] == 0);
+    }
+    assert(tracking_live[1] == 0 && tracking_live[2] == 0);
+
+    {
+        using Alloc = TrackingAlloc<Obj, false, false>;
+        nstd::vector<Obj, Alloc> a({1, 2, 3}, Alloc{1});
+        nstd::vector<Obj, Alloc> b({4, 5}, Alloc{2});
+        auto* buffer = a.data();
+
+        // Not propagating and unequal: elements are moved into memory from b's own allocator.
+        b = std::move(a);
+        assert(b.get_allocator().id == 2);
+        assert(b.data() != buffer);
+        assert(b.size() == 3 && b[0].value == 1 && b[2].value == 3);
+    }
+    assert(tracking_live[1] == 0 && tracking_live[2] == 0);
+
+    {
+        // Not propagating but equal: the buffer can still be stolen.
+        using Alloc = TrackingAlloc<Obj, false, false>;
+        nstd::vector<Obj, Alloc> a({1, 2, 3}, Alloc{1});
+        nstd::vector<Obj, Alloc> b({4, 5}, Alloc{1});
+        auto* buffer = a.data();
+
+        b = std::move(a);
+        assert(b.data() == buffer);
+    }
+    assert(tracking_live[1] == 0);
+
+    Obj::verify_no_leaks();
+    std::cout << "PASSED\n";
+}
+
+void test_allocator_swap_propagation() {
+    std::cout << "[Test] Allocator Swap Propagation... ";
+
+    {
+        using Alloc = TrackingAlloc<int, false, false, true>;
+        nstd::vector<int, Alloc> a({1, 2, 3}, Alloc{1});
+        nstd::vector<int, Alloc> b({4, 5}, Alloc{2});
+
+        swap(a, b);
+        assert(a.get_allocator().id == 2 && a.size() == 2);
+        assert(b.get_allocator().id == 1 && b.size() == 3);
+    }
+    assert(tracking_live[1] == 0 && tracking_live[2] == 0);
+
+    std::cout << "PASSED\n";
+}
+
+void test_allocator_arena_and_slab() {
+    std::cout << "[Test] Arena / Slab Backed Vectors... ";
+
+    {
+        nstd::inline_arena<4096> arena;
+        nstd::vector<int, nstd::arena_allocator<int>> v{nstd::arena_allocator<int>{arena}};
+        for (int i = 0; i < 200; ++i) {
+            v.push_back(i);
+        }
+        assert(v.size() == 200 && v[199] == 199);
+    }
+
+    {
+        nstd::slab_resource slab;
+        nstd::vector<std::string, nstd::slab_allocator<std::string>> v{
+            nstd::slab_allocator<std::string>{slab}};
+        for (int i = 0; i < 50; ++i) {
+            v.emplace_back(std::to_string(i));
+        }
+        v.erase(v.begin());
+        v.shrink_to_fit();
+        assert(v.size() == 49 && v.front() == "1");
+    }
+
+    std::cout << "PASSED\n";
+}
+
+// ==========================================
+// HELPER: Type that opts in to trivial relocation
+// ==========================================
+// Counts moves, so a test can tell relocation by memcpy from relocation by move construction.
+struct Relocatable {
+    static int move_count;
+
+    nstd::unique_ptr<int> value;
+
+    Relocatable(int v) : value(new int(v)) {}
+
+    Relocatable(Relocatable&& other) noexcept : value(std::move(other.value)) {
+        ++move_count;
+    }
+
+    Relocatable& operator=(Relocatable&& other) noexcept {
+        value = std::move(other.value);
+        ++move_count;
+        return *this;
+    }
+};
+
+int Relocatable::move_count = 0;
+
+} // namespace vector
+} // namespace tests
+
+template<> struct nstd::is_trivially_relocatable<tests::vector::Relocatable> : std::true_type {};
+
+namespace tests {
+namespace vector {
+
+// Allocator with a construct() member, which rules out bitwise relocation.
+template<typename T> struct ConstructingAlloc {
+    using value_type = T;
+
+    static inline int construct_count = 0;
+
+    ConstructingAlloc() = default;
+    template<typename U> ConstructingAlloc(const ConstructingAlloc<U>&) {}
+
+    T* allocate(size_t n) {
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template<typename... Args> void construct(T* p, Args&&... args) {
+        ++construct_count;
+        ::new (static_cast<void*>(p)) T(std::forward<Args>(args)...);
+    }
+
+    friend bool operator==(const ConstructingAlloc&, const ConstructingAlloc&) {
+        return true;
+    }
+};
+
+static_assert(nstd::is_trivially_relocatable_v<int>);
+static_assert(nstd::is_trivially_relocatable_v<std::allocator<Obj>>);
+static_assert(nstd::is_trivially_relocatable_v<nstd::string>);
+static_assert(nstd::is_trivially_relocatable_v<nstd::unique_ptr<Obj>>);
+static_assert(nstd::is_trivially_relocatable_v<nstd::shared_ptr<Obj>>);
+static_assert(nstd::is_trivially_relocatable_v<nstd::vector<nstd::string>>);
+static_assert(!nstd::is_trivially_relocatable_v<Obj>);
+static_assert(!nstd::is_trivially_relocatable_v<std::string>);
+static_assert(!nstd::is_trivially_relocatable_v<std::pair<int, double>>);
+
+void test_relocation_trivially_relocatable() {
+    std::cout << "[Test] Relocation: Opted-in Types Grow Without Moves... ";
+
+    {
+        // Mix of inline and heap strings; both layouts have to survive being memcpy'd.
+        nstd::vector<nstd::string> strings;
+        for (int i = 0; i < 1000; ++i) {
+            strings.push_back(
+                nstd::string(static_cast<size_t>(i % 40), static_cast<char>('a' + i % 26)));
+        }
+        strings.shrink_to_fit();
+        for (int i = 0; i < 1000; ++i) {
+            assert(strings[i].size() == static_cast<size_t>(i % 40));
+            assert(strings[i].empty() || strings[i][0] == 'a' + i % 26);
+        }
+    }
+
+    {
+        Relocatable::move_count = 0;
+        nstd::vector<Relocatable> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.emplace_back(i);
+        }
+        v.reserve(5000);
+        assert(Relocatable::move_count == 0);
+        for (int i = 0; i < 1000; ++i) {
+            assert(*v[i].value == i);
+        }
+    }
+
+    {
+        nstd::vector<nstd::vector<nstd::unique_ptr<Obj>>> nested;
+        for (int i = 0; i < 100; ++i) {
+            nested.emplace_back();
+            for (int j = 0; j <= i % 5; ++j) {
+                nested.back().emplace_back(new Obj(i));
+            }
+        }
+        assert(nested[99].size() == 5 && nested[99][4]->value == 99);
+        nested.erase(nested.begin());
+        assert(nested.front().front()->value == 1);
+    }
+    Obj::verify_no_leaks();
+
+    {
+        nstd::vector<nstd::shared_ptr<int>> shared;
+        auto first = nstd::make_shared<int>(7);
+        for (int i = 0; i < 100; ++i) {
+            shared.push_back(first);
+        }
+        assert(first.use_count() == 101);
+        shared.clear();
+        assert(first.use_count() == 1);
+    }
+
+    std::cout << "PASSED\n";
+}
+
+void test_relocation_fallbacks() {
+    std::cout << "[Test] Relocation: Move Construction Where Required... ";
+
+    // Non-relocatable elements are still moved one by one.
+    Obj::reset_stats();
+    {
+        nstd::vector<Obj> v;
+        v.reserve(2);
+        v.emplace_back(1);
+        v.emplace_back(2);
+        v.reserve(10);
+        assert(Obj::move_count == 2);
+        assert(v[0].value == 1 && v[1].value == 2);
+    }
+    Obj::verify_no_leaks();
+
+    // An allocator with construct() sees every element, even trivially copyable ones.
+    {
+        nstd::vector<int, ConstructingAlloc<int>> v;
+        for (int i = 0; i < 4; ++i) {
+            v.push_back(i);
+        }
+        const int before = ConstructingAlloc<int>::construct_count;
+        v.reserve(100);
+        assert(ConstructingAlloc<int>::construct_count == before + 4);
+        assert(v[3] == 3);
+    }
+
+    // Trivially copyable elements with a custom allocator are copied into its memory.
+    {
+        nstd::vector<int, TrackingAlloc<int>> v{TrackingAlloc<int>{3}};
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+        v.shrink_to_fit();
+        assert(tracking_live[3] == static_cast<long long>(1000 * sizeof(int)));
+        assert(v[999] == 999);
+    }
+    assert(tracking_live[3] == 0);
+
+    // Over-aligned elements bypass malloc/realloc.
+    {
+        struct alignas(64) Wide {
+            int value;
+        };
+        nstd::vector<Wide> v;
+        for (int i = 0; i < 100; ++i) {
+            v.push_back(Wide{i});
+            assert(reinterpret_cast<std::uintptr_t>(v.data()) % 64 == 0);
+        }
+        assert(v[99].value == 99);
+    }
+
+    std::cout << "PASSED\n";
+}
+
+void benchmark_relocation_growth() {
+    std::cout << "[Benchmark] Relocation: Growth of a Large POD Vector vs std::vector...\n";
+    constexpr size_t count = size_t{16} << 20; // 64 MiB of ints
+
+    std::vector<int> std_vec(count, 1);
+    nstd::vector<int> nstd_vec(count, 1);
+
+    // Doubling a full buffer: std::vector copies every element into the new block, realloc can
+    // remap the pages instead.
+    const auto std_ms = time_ms([&] { std_vec.reserve(count * 2); });
+    const auto nstd_ms = time_ms([&] { nstd_vec.reserve(count * 2); });
+    assert(nstd_vec.size() == count && nstd_vec[count - 1] == 1);
+
+    std::vector<int> std_grown;
+    const auto std_push_ms = time_ms([&] {
+        for (size_t i = 0; i < count; ++i) {
+            std_grown.push_back(static_cast<int>(i));
+        }
+    });
+    nstd::vector<int> nstd_grown;
+    const auto nstd_push_ms = time_ms([&] {
+        for (size_t i = 0; i < count; ++i) {
+            nstd_grown.push_back(static_cast<int>(i));
+        }
+    });
+    assert(nstd_grown[count - 1] == std_grown[count - 1]);
+
+    std::cout << "    reserve(2x) std::vector:    " << std_ms << "ms\n";
+    std::cout << "    reserve(2x) nstd::vector:   " << nstd_ms << "ms\n";
+    std::cout << "    16M push_back std::vector:  " << std_push_ms << "ms\n";
+    std::cout << "    16M push_back nstd::vector: " << nstd_push_ms << "ms\n";
+}
+
+// ==========================================
+// RANGE TESTS
+// ==========================================
+
+void test_range_single_allocation() {
+    std::cout << "[Test] Range: Constructor / append_range / assign_range... ";
+
+    // A measurable source is stored in one allocation of exactly its size.
+    {
+        std::list<int> src = {1, 2, 3, 4, 5};
+        nstd::vector<int> v(src.begin(), src.end());
+        assert(v.size() == 5 && v.get_capacity() == 5 && v[4] == 5);
+
+        auto square = [](int i) { return i * i; };
+        auto squares = std::views::iota(0, 1000) | std::views::transform(square);
+        nstd::vector<int> w;
+        w.append_range(squares);
+        assert(w.size() == 1000 && w.get_capacity() == 1000 && w[999] == 999 * 999);
+
+        w.append_range(std::vector<int>{1, 2, 3});
+        assert(w.size() == 1003 && w.get_capacity() == 2000 && w.back() == 3);
+
+        w.assign_range(src);
+        assert(w.size() == 5 && w.get_capacity() == 2000 && w[0] == 1);
+        w.assign_range(std::views::iota(0, 3000));
+        assert(w.size() == 3000 && w.get_capacity() == 3000 && w[2999] == 2999);
+        w.assign_range(std::vector<int>{});
+        assert(w.is_empty() && w.data() == nullptr);
+    }
+
+    // insert_range at every position of a small vector, against std::vector.
+    for (size_t pos = 0; pos <= 4; ++pos) {
+        nstd::vector<std::string> v = {"a", "b", "c", "d"};
+        std::vector<std::string> expected(v.begin(), v.end());
+        const std::vector<std::string> src = {"x", "y", "z"};
+        auto it = v.insert_range(v.cbegin() + pos, src);
+        expected.insert(expected.begin() + pos, src.begin(), src.end());
+        assert(it == v.begin() + pos && *it == "x");
+        assert(std::equal(v.begin(), v.end(), expected.begin(), expected.end()));
+    }
+
+    // Move iterators hand the elements over.
+    {
+        std::vector<nstd::unique_ptr<int>> src;
+        for (int i = 0; i < 4; ++i) {
+            src.emplace_back(new int(i));
+        }
+        nstd::vector<nstd::unique_ptr<int>> v(std::make_move_iterator(src.begin()),
+                                              std::make_move_iterator(src.end()));
+        assert(v.get_capacity() == 4 && *v[3] == 3 && !src[3]);
+    }
+
+    std::cout << "PASSED\n";
+}
+
+void test_range_single_pass_input() {
+    std::cout << "[Test] Range: Single-Pass Input... ";
+
+    {
+        std::istringstream in{"1 2 3 4"};
+        nstd::vector<int> v(std::istream_iterator<int>{in}, std::istream_iterator<int>{});
+        assert(v == (nstd::vector<int>{1, 2, 3, 4}));
+
+        std::istringstream more{"8 9"};
+        auto it = v.insert(v.cbegin() + 1, std::istream_iterator<int>{more},
+                           std::istream_iterator<int>{});
+        assert(*it == 8);
+        assert(v == (nstd::vector<int>{1, 8, 9, 2, 3, 4}));
+
+        std::istringstream other{"7 7"};
+        v.assign(std::istream_iterator<int>{other}, std::istream_iterator<int>{});
+        assert(v == (nstd::vector<int>{7, 7}));
+
+        std::istringstream words{"p q r"};
+        nstd::vector<std::string> w = {"a", "b"};
+        w.insert_range(w.cbegin() + 1, std::views::istream<std::string>(words));
+        assert(w.size() == 5 && w[1] == "p" && w[3] == "r" && w[4] == "b");
+    }
+
+    std::cout << "PASSED\n";
+}
+
+void test_range_exception_safety() {
+    std::cout << "[Test] Range: Exception Safety... ";
+
+    const std::vector<int> numbers = {1, 2, 3, 4};
+    auto failing = [](int limit) {
+        return [limit](int i) {
+            if (i > limit) {
+                throw std::runtime_error("conversion failed");
+            }
+            return i;
+        };
+    };
+
+    // Relocatable elements: the gap is closed again.
+    {
+        nstd::vector<nstd::string> v = {nstd::string("one string that is stored on the heap"),
+                                        nstd::string("another one, which is also heap stored")};
+        auto to_string = [](int i) { return nstd::string(size_t{30}, static_cast<char>('a' + i)); };
+        auto strings = numbers | std::views::transform(failing(2)) |
+                       std::views::transform(to_string);
+        try {
+            v.insert_range(v.cbegin() + 1, strings);
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+        assert(v.size() == 2 && v[0][0] == 'o' && v[1][0] == 'a');
+    }
+
+    // Reallocating: the original buffer is untouched.
+    Obj::reset_stats();
+    {
+        nstd::vector<Obj> v = {Obj(1), Obj(2)};
+        v.shrink_to_fit();
+        auto objects = numbers | std::views::transform(failing(3)) |
+                       std::views::transform([](int i) { return Obj(i); });
+        try {
+            v.insert_range(v.cbegin() + 1, objects);
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+        assert(v.size() == 2 && v[0].value == 1 && v[1].value == 2);
+
+        // Within capacity the vector stays valid and nothing leaks.
+        v.reserve(10);
+        try {
+            v.insert_range(v.cbegin(), objects);
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+        try {
+            v.assign_range(objects);
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+    }
+    Obj::verify_no_leaks();
+
+    std::cout << "PASSED\n";
+}
+
+void benchmark_range() {
+    std::cout << "[Benchmark] Range: Bulk Append / Insert vs Element-wise...\n";
+    constexpr int chunks = 2000;
+    const std::vector<int> chunk(4096, 7);
+
+    nstd::vector<int> one_by_one;
+    const auto push_ms = time_ms([&] {
+        for (int i = 0; i < chunks; ++i) {
+            for (int value : chunk) {
+                one_by_one.push_back(value);
+            }
+        }
+    });
+    nstd::vector<int> bulk;
+    const auto append_ms = time_ms([&] {
+        for (int i = 0; i < chunks; ++i) {
+            bulk.append_range(chunk);
+        }
+    });
+    assert(bulk == one_by_one);
+
+    // Inserting near the front: one shift per range instead of one per element.
+    nstd::vector<int> front(100000, 1);
+    const auto insert_ms = time_ms([&] {
+        for (int i = 0; i < 200; ++i) {
+            front.insert(front.cbegin() + 10, chunk.begin(), chunk.begin() + 64);
+        }
+    });
+    std::vector<int> std_front(100000, 1);
+    const auto std_insert_ms = time_ms([&] {
+        for (int i = 0; i < 200; ++i) {
+            std_front.insert(std_front.begin() + 10, chunk.begin(), chunk.begin() + 64);
+        }
+    });
+    assert(front.size() == std_front.size());
+
+    std::cout << "    8M push_back:               " << push_ms << "ms\n";
+    std::cout << "    append_range, 4K chunks:    " << append_ms << "ms\n";
+    std::cout << "    200 range inserts (nstd):   " << insert_ms << "ms\n";
+    std::cout << "    200 range inserts (std):    " << std_insert_ms << "ms\n";
+}
+
 // ==========================================
 // MAIN RUNNER
 // ==========================================
@@ -1640,7 +2290,7 @@ void run_all_tests() {
     // Insert/Erase
     test_insert_single();
     test_insert_count();
-    //			test_insert_range();
+    test_insert_range();
     test_insert_aliasing();
     test_erase();
 
@@ -1664,6 +2314,25 @@ void run_all_tests() {
     test_edge_case_boundary_insert_erase();
     test_edge_case_complex_objects();
 
+    // Allocators
+    std::cout << "\n--- Allocator Testing ---\n";
+    test_allocator_stateful();
+    test_allocator_copy_assignment_propagation();
+    test_allocator_move_assignment_propagation();
+    test_allocator_swap_propagation();
+    test_allocator_arena_and_slab();
+
+    // Relocation
+    std::cout << "\n--- Relocation Testing ---\n";
+    test_relocation_trivially_relocatable();
+    test_relocation_fallbacks();
+
+    // Ranges
+    std::cout << "\n--- Range Testing ---\n";
+    test_range_single_allocation();
+    test_range_single_pass_input();
+    test_range_exception_safety();
+
     std::cout << "\n==========================================\n";
     std::cout << "  ALL TESTS PASSED SUCCESSFULLY!\n";
     std::cout << "  Total: 30 test suites\n";